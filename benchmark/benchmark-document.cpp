@@ -0,0 +1,76 @@
+#include <chrono>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include <qcon-dom.hpp>
+
+using qcon::u8;
+using qcon::u16;
+using qcon::u64;
+using qcon::s64;
+
+// A typical request body: a few nested objects and arrays of short strings, numbers, and dates
+std::string createQcon(const u64 recordCount)
+{
+    qcon::Encoder encoder{qcon::nospace};
+    encoder << qcon::object << "records" << qcon::array;
+    for (u64 i{0u}; i < recordCount; ++i)
+    {
+        encoder << qcon::object;
+        encoder << "id" << s64(i);
+        encoder << "name" << ("user" + std::to_string(i));
+        encoder << "active" << (i % 3u != 0u);
+        encoder << "joined" << qcon::Date{u16(2000u + i % 24u), u8(1u + i % 12u), u8(1u + i % 28u)};
+        encoder << "tags" << qcon::array << "alpha" << "beta" << "gamma" << qcon::end;
+        encoder << "location" << qcon::object << "x" << double(i) * 0.5 << "y" << double(i) * 1.5 << qcon::end;
+        encoder << qcon::end;
+    }
+    encoder << qcon::end << qcon::end;
+    return *encoder.finish();
+}
+
+template <typename F> double time(const F & f)
+{
+    double best{1.0e9};
+    for (u64 run{0u}; run < 5u; ++run)
+    {
+        const auto start{std::chrono::steady_clock::now()};
+        f();
+        best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+bool benchmark(const u64 requestCount, const u64 recordCount)
+{
+    std::cout << requestCount << " requests of " << recordCount << " records\n";
+
+    const std::string qcon{createQcon(recordCount)};
+
+    // Decode each request and discard it
+    bool valid{true};
+    const double valueMs{time([&] {
+        for (u64 i{0u}; i < requestCount; ++i)
+        {
+            const std::optional<qcon::Value> value{qcon::decode(qcon)};
+            valid = valid && value;
+        }
+    })};
+    const double documentMs{time([&] {
+        for (u64 i{0u}; i < requestCount; ++i)
+        {
+            const std::optional<qcon::Document> document{qcon::decodeArena(qcon)};
+            valid = valid && document;
+        }
+    })};
+
+    std::cout << "    Decode and discard: qcon::Value " << valueMs << " ms, qcon::Document " << documentMs << " ms (" << valueMs / documentMs << "x)\n";
+
+    return valid && qcon::decodeArena(qcon)->root() == *qcon::decode(qcon);
+}
+
+int main()
+{
+    return !(benchmark(10'000u, 10u) && benchmark(100u, 10'000u));
+}
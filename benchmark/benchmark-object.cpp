@@ -0,0 +1,136 @@
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <qcon-dom.hpp>
+
+using qcon::u64;
+using qcon::s64;
+
+using Map = std::map<std::string, qcon::Value>;
+
+std::vector<std::string> createKeys(const u64 keyCount)
+{
+    static const std::vector<std::string> typicalKeys{
+        "id", "name", "email", "active", "age", "score", "created", "group", "region", "tier", "notes", "manager"};
+
+    if (keyCount <= typicalKeys.size())
+    {
+        return {typicalKeys.begin(), typicalKeys.begin() + ptrdiff_t(keyCount)};
+    }
+
+    std::vector<std::string> keys{};
+    for (u64 k{0u}; k < keyCount; ++k)
+    {
+        keys.push_back("key" + std::to_string((k * 7919u) % keyCount));
+    }
+    return keys;
+}
+
+std::string createQcon(const u64 objectCount, const std::vector<std::string> & keys)
+{
+    qcon::Encoder encoder{qcon::nospace};
+    encoder << qcon::array;
+    for (u64 i{0u}; i < objectCount; ++i)
+    {
+        // Keys in a fixed, unsorted order, as is typical of real data
+        encoder << qcon::object;
+        for (u64 k{0u}; k < keys.size(); ++k)
+        {
+            encoder << keys[k] << s64(i * keys.size() + k);
+        }
+        encoder << qcon::end;
+    }
+    encoder << qcon::end;
+    return *encoder.finish();
+}
+
+// Decodes the same way as `qcon::decode`, but into the given object type
+template <typename T> std::vector<T> decodeAll(const std::string & qcon)
+{
+    std::vector<T> objects{};
+    qcon::Decoder decoder{qcon};
+    decoder >> qcon::array;
+    while (decoder.more())
+    {
+        T & object{objects.emplace_back()};
+        decoder >> qcon::object;
+        while (decoder.more())
+        {
+            decoder >> decoder.key >> decoder.integer;
+            object.emplace(std::move(decoder.key), decoder.integer);
+        }
+    }
+    return objects;
+}
+
+template <typename T> s64 lookupAll(const std::vector<T> & objects, const std::vector<std::string> & keys)
+{
+    s64 sum{0};
+    for (const T & object : objects)
+    {
+        for (const std::string & key : keys)
+        {
+            sum += *object.find(key)->second.integer();
+        }
+    }
+    return sum;
+}
+
+template <typename T> s64 iterateAll(const std::vector<T> & objects)
+{
+    s64 sum{0};
+    for (const T & object : objects)
+    {
+        for (const auto & [key, value] : object)
+        {
+            sum += *value.integer();
+        }
+    }
+    return sum;
+}
+
+template <typename F> double time(const F & f)
+{
+    double best{1.0e9};
+    for (u64 run{0u}; run < 5u; ++run)
+    {
+        const auto start{std::chrono::steady_clock::now()};
+        f();
+        best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+void report(const char * const name, const double mapMs, const double objectMs)
+{
+    std::cout << "    " << name << ": std::map " << mapMs << " ms, qcon::Object " << objectMs << " ms (" << mapMs / objectMs << "x)\n";
+}
+
+bool benchmark(const u64 objectCount, const u64 keyCount)
+{
+    std::cout << objectCount << " objects of " << keyCount << " members\n";
+
+    const std::vector<std::string> keys{createKeys(keyCount)};
+    const std::string qcon{createQcon(objectCount, keys)};
+
+    std::vector<Map> maps{};
+    std::vector<qcon::Object> objects{};
+    report("Decode", time([&] { maps = decodeAll<Map>(qcon); }), time([&] { objects = decodeAll<qcon::Object>(qcon); }));
+
+    s64 mapSum{}, objectSum{};
+    report("Lookup", time([&] { mapSum = lookupAll(maps, keys); }), time([&] { objectSum = lookupAll(objects, keys); }));
+    if (mapSum != objectSum) return false;
+
+    report("Iterate", time([&] { mapSum = iterateAll(maps); }), time([&] { objectSum = iterateAll(objects); }));
+    if (mapSum != objectSum) return false;
+
+    return true;
+}
+
+int main()
+{
+    return !(benchmark(100'000u, 12u) && benchmark(100u, 10'000u));
+}
@@ -0,0 +1,94 @@
+#include <iostream>
+
+#include <qcon-encode.hpp>
+#include <qcon-decode.hpp>
+
+struct Employee
+{
+    std::string name;
+    std::chrono::year_month_day birthday;
+    bool fullTime;
+    double hourlyWage;
+
+    bool operator==(const Employee &) const = default;
+};
+
+struct Business
+{
+    std::string name;
+    std::chrono::minutes openTime;
+    std::chrono::minutes closeTime;
+    std::vector<Employee> employees;
+    std::chrono::system_clock::time_point lastUpdated;
+
+    bool operator==(const Business &) const = default;
+};
+
+// Binding each struct's members to keys replaces the hand-written encoding and decoding of the SAX example
+
+template <> struct qcon::Binding<Employee>
+{
+    static constexpr auto fields{qcon::fields(
+        "Name", &Employee::name,
+        "Birthday", &Employee::birthday,
+        "Full Time", &Employee::fullTime,
+        "Hourly Wage", &Employee::hourlyWage)};
+};
+
+template <> struct qcon::Binding<Business>
+{
+    static constexpr auto fields{qcon::fields(
+        "Name", &Business::name,
+        "Open Time", &Business::openTime,
+        "Close Time", &Business::closeTime,
+        "Employees", &Business::employees,
+        "Last Updated", &Business::lastUpdated)};
+};
+
+void abortIf(const bool condition)
+{
+    if (condition)
+    {
+        std::abort();
+    }
+}
+
+int main()
+{
+    // Create example business
+    Business business;
+    business.name = "Phil's Phillies";
+    business.openTime = std::chrono::hours{8} + std::chrono::minutes{30};
+    business.closeTime = std::chrono::hours{22};
+    business.employees.push_back(Employee{
+        .name = "Phil",
+        .birthday = std::chrono::year_month_day{std::chrono::year{1969}, std::chrono::month{3}, std::chrono::day{17}},
+        .fullTime = true,
+        .hourlyWage = 35.0});
+    business.employees.push_back(Employee{
+        .name = "Ted",
+        .birthday = std::chrono::year_month_day{std::chrono::year{1981}, std::chrono::month{9}, std::chrono::day{1}},
+        .fullTime = false,
+        .hourlyWage = 21.5});
+    business.lastUpdated = std::chrono::system_clock::now();
+
+    // Encode QCON
+    qcon::Encoder encoder{};
+    encoder << business;
+    const std::optional<std::string> qconStr{encoder.finish()};
+    abortIf(!qconStr);
+
+    // Print encoded QCON
+    std::cout << "Encoded:\n" << *qconStr << std::endl;
+
+    // Decode QCON
+    Business decodedBusiness;
+    qcon::Decoder decoder{*qconStr};
+    abortIf(!(decoder >> decodedBusiness));
+    abortIf(!decoder.finished());
+
+    // Ensure decoded object matches original
+    abortIf(decodedBusiness != business);
+
+    return 0;
+}
@@ -6,6 +6,9 @@
 #include <compare>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace qcon
 {
@@ -150,6 +153,42 @@ namespace qcon
     static_assert(sizeof(Date) == 4u);
     static_assert(sizeof(Time) == 8u);
     static_assert(sizeof(Datetime) == 16u);
+
+    ///
+    /// Specialize to bind the members of a struct to the keys of a QCON object, which allows the struct to be encoded
+    ///   and decoded directly rather than by hand-written `operator<<` and `operator>>`
+    /// The specialization must have a `static constexpr` member `fields` created by `qcon::fields`
+    /// Members may be of any type that may be encoded and decoded, another bound struct, a `std::vector` of these, a
+    ///   `std::chrono::year_month_day` as a date, or a `std::chrono::duration` as a time since midnight
+    ///
+    /// Example:
+    ///     template <> struct qcon::Binding<Employee>
+    ///     {
+    ///         static constexpr auto fields{qcon::fields("Name", &Employee::name, "Full Time", &Employee::fullTime)};
+    ///     };
+    ///
+    template <typename T> struct Binding;
+
+    ///
+    /// Whether `Binding` has been specialized for the type
+    ///
+    template <typename T> concept Bound = requires { Binding<T>::fields; };
+
+    ///
+    /// A key bound to a member
+    ///
+    template <typename T, typename M> struct Field
+    {
+        std::string_view key;
+        M T::* member;
+    };
+
+    ///
+    /// Creates the fields of a `Binding`
+    /// @param args alternating keys and member pointers
+    /// @return tuple of each key and member as a `Field`
+    ///
+    template <typename... Args> [[nodiscard]] constexpr auto fields(const Args &... args);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,6 +206,29 @@ namespace qcon
         {
             return u8(c) < 32u;
         }
+
+        template <typename T> inline constexpr bool isVector{false};
+        template <typename E, typename A> inline constexpr bool isVector<std::vector<E, A>>{true};
+
+        template <typename T> inline constexpr bool isDuration{false};
+        template <typename R, typename P> inline constexpr bool isDuration<std::chrono::duration<R, P>>{true};
+
+        inline constexpr std::tuple<> makeFields()
+        {
+            return {};
+        }
+
+        template <typename T, typename M, typename... Args> inline constexpr auto makeFields(const std::string_view key, M T::* const member, const Args &... args)
+        {
+            return std::tuple_cat(std::tuple<Field<T, M>>{Field<T, M>{key, member}}, makeFields(args...));
+        }
+    }
+
+    template <typename... Args> inline constexpr auto fields(const Args &... args)
+    {
+        static_assert(sizeof...(Args) % 2u == 0u, "Expected alternating keys and members");
+
+        return _private::makeFields(args...);
     }
 
     inline Date Date::from(const std::chrono::year_month_day & ymd)
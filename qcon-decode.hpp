@@ -8,17 +8,77 @@
 ///
 
 #include <array>
+#include <bit>
 #include <charconv>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
 #include <format>
 #include <limits>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <qcon-common.hpp>
 
+///
+/// SIMD scanning is used where available, and may be disabled by defining `QCON_NO_SIMD`
+/// Block loads may read past the null terminator (though never across a page boundary), so they are automatically
+///   disabled under AddressSanitizer, which would report them
+///
+#if defined(__SANITIZE_ADDRESS__)
+    #define QCON_ASAN
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define QCON_ASAN
+    #endif
+#endif
+
+#if !defined(QCON_NO_SIMD) && !defined(QCON_ASAN)
+    #if defined(__AVX2__)
+        #define QCON_AVX2
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+        #define QCON_SSE2
+    #endif
+#endif
+
+#if defined(QCON_SSE2)
+    #include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#if defined(_WIN32)
+    #if !defined(WIN32_LEAN_AND_MEAN)
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #if !defined(NOMINMAX)
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/// Keeps cold scanning loops from bloating the hot functions they are called from
+#if defined(_MSC_VER)
+    #define QCON_NOINLINE __declspec(noinline)
+#else
+    #define QCON_NOINLINE __attribute__((noinline))
+#endif
+
 namespace qcon
 {
     ///
@@ -39,7 +99,104 @@ namespace qcon
         date,     /// A date value was decoded
         time,     /// A time value was decoded
         datetime, /// A datetime value was decoded
-        null     /// A null value was decoded
+        null,     /// A null value was decoded
+        skipped   /// A value was skipped
+    };
+
+    ///
+    /// The kind of error that occurred while decoding
+    ///
+    enum class ErrorCode
+    {
+        none,                    /// No error has occurred
+        failedToOpenFile,        /// The file could not be opened
+        expectedValue,           /// A value was missing
+        unknownValue,            /// A value was not of any known type
+        unexpectedEnd,           /// The QCON ended within a container
+        extraneousRootContent,   /// There was content after the root value
+        multipleRootValues,      /// A second root value was decoded
+        expectedKey,             /// A value was decoded in an object without a key
+        expectedComma,           /// A comma was missing between elements while streaming
+        missingObjectComma,      /// A comma was missing between object elements
+        missingArrayComma,       /// A comma was missing between array elements
+        moreElements,            /// A container was ended while it had more elements
+        exceededMaxDepth,        /// Containers were nested deeper than `maxDepth`
+        expectedCharacter,       /// A specific character was missing
+        expectedCharacters,      /// A specific sequence of characters was missing
+        expectedObject,          /// The value was not an object
+        expectedArray,           /// The value was not an array
+        expectedInteger,         /// The value was not an integer
+        expectedFloater,         /// The value was not a floater
+        expectedBoolean,         /// The value was not a boolean
+        expectedSingleCharacter, /// The string was not a single character
+        invalidStringContent,    /// A string contained an invalid character or was unterminated
+        invalidEscapeSequence,   /// A string contained an invalid escape sequence
+        codepointTooLarge,       /// An escaped codepoint was too large
+        expectedDecimalDigits,   /// Too few decimal digits
+        expectedHexDigits,       /// Too few hex digits
+        missingBinaryDigit,      /// A binary integer had no digits
+        missingOctalDigit,       /// An octal integer had no digits
+        missingDecimalDigit,     /// A decimal number had no digits
+        missingHexDigit,         /// A hex integer had no digits
+        negativeIntegerTooLarge, /// A negative integer was too large to fit in a `s64`
+        negativeUnsigned,        /// A negative integer was decoded into an unsigned integer
+        signedIntegerTooLarge,   /// An integer was too large for the signed integer type it was decoded into
+        unsignedIntegerTooLarge, /// An integer was too large for the unsigned integer type it was decoded into
+        invalidFloater,          /// A floater was malformed or out of range
+        invalidMonth,            /// A date had an invalid month
+        invalidDay,              /// A date had an invalid day
+        invalidHour,             /// A time or timezone had an invalid hour
+        invalidMinute,           /// A time or timezone had an invalid minute
+        invalidSecond,           /// A time had an invalid second
+        missingKey,              /// No member had the requested key
+        indexOutOfRange,         /// The array had no element at the requested index
+        inputAlreadyClosed,      /// Input was fed after being closed
+        insufficientInput,       /// Decoding was attempted before enough input was fed
+        unfinishedDocument       /// Moved on to another document before the current one was fully decoded
+    };
+
+    ///
+    /// Read-only memory mapping of a whole file
+    ///
+    class _MappedFile
+    {
+      public:
+
+        _MappedFile() = default;
+
+        _MappedFile(const _MappedFile &) = delete;
+        _MappedFile(_MappedFile && other);
+
+        _MappedFile & operator=(const _MappedFile &) = delete;
+        _MappedFile & operator=(_MappedFile && other);
+
+        ~_MappedFile();
+
+        ///
+        /// Maps the given file, replacing any existing mapping
+        /// @param path path of the file to map
+        /// @return whether the file was successfully mapped; an empty file is never mapped
+        ///
+        [[nodiscard]] bool map(const std::filesystem::path & path);
+
+        void unmap();
+
+        ///
+        /// @return whether the byte following the mapped content is readable, which is the case unless the file size
+        ///   is a multiple of the page size; mapped pages are zero-filled past the end of the file
+        ///
+        [[nodiscard]] bool padded() const { return _size % _pageSize(); }
+
+        [[nodiscard]] const char * data() const { return _data; }
+
+        [[nodiscard]] u64 size() const { return _size; }
+
+      private:
+
+        const char * _data{};
+        u64 _size{};
+
+        [[nodiscard]] static u64 _pageSize();
     };
 
     ///
@@ -52,6 +209,8 @@ namespace qcon
 
         std::string key{};    /// If an object element was just decoded, holds its key; unspecified otherwise; may be moved from
         std::string string{}; /// If a string was just decoded, holds its value; unspecified otherwise; may be moved from
+        std::string_view keyView{};    /// If an object element was just decoded, views its key; invalidated by the next decode or by modifying `key`
+        std::string_view stringView{}; /// If a string was just decoded, views its value; invalidated by the next decode or by modifying `string`
         s64 integer{};        /// If an integer was just decoded, holds its value; unspecified otherwise
         f64 floater{};     /// If a floater was just decoded, holds its value; unspecified otherwise
         bool positive{};      /// If a number was just decoded, indicates whether it was positive; unspecified otherwise
@@ -59,7 +218,26 @@ namespace qcon
         Datetime datetime{};  /// If a datetime was just decoded, holds its value; unspecified otherwise
         Date & date{datetime.date}; /// If a date was just decoded, holds its value; unspecified otherwise; alias for `datetime.date`
         Time & time{datetime.time}; /// If a time was just decoded, holds its value; unspecified otherwise; alias for `datetime.time`
-        std::string errorMessage{}; /// Holds a brief description of the most recent error; may be moved from
+
+        ///
+        /// If set, keys and strings without escapes or concatenation are not copied into `key` and `string`; instead
+        ///   `keyView` and `stringView` reference them directly in the QCON, which must then outlive their use
+        /// Other keys and strings are still unescaped into `key` and `string`, and the views reference those
+        ///
+        bool zeroCopy{false};
+
+        ///
+        /// Maximum nesting depth of containers; deeper QCON yields an error
+        /// Up to 64 levels are tracked inline, beyond which the decoder allocates
+        ///
+        u64 maxDepth{64u};
+
+        ///
+        /// If set, the QCON is a stream of any number of root values, one after another, such as newline-delimited logs
+        /// Each root value is its own document, moved on to with `nextDocument`
+        /// Root strings are not concatenated with one another, as they are separate documents
+        ///
+        bool documentStream{false};
 
         Decoder();
 
@@ -78,7 +256,13 @@ namespace qcon
         Decoder(const char * qson);
         Decoder(const std::string & qson) : Decoder{qson.c_str()} {}
         Decoder(std::string &&) = delete; // Prevent binding to temporary
-        Decoder(std::string_view) = delete; /// QCON string must be null terminated; pass c-string instead
+
+        ///
+        /// Constructs a decoder and loads the given bounded QSON string
+        /// Equivalent to `Decoder d{}; d.load(qcon, length, padded)`
+        ///
+        Decoder(const char * qson, u64 length, bool padded = false);
+        Decoder(std::string_view qson) : Decoder{qson.data(), qson.size()} {}
 
         ///
         /// @return whether the decoding has been thusfar successful
@@ -93,7 +277,28 @@ namespace qcon
         void load(const char * qson);
         void load(const std::string & qson) { load(qson.c_str()); }
         void load(std::string &&) = delete; /// Prevent binding to temporary
-        void load(std::string_view) = delete; /// QCON string must be null terminated; pass c-string instead
+
+        ///
+        /// Loads the given bounded QSON string, overriding any existing state
+        /// The QSON string need not be null terminated, and may not contain null characters
+        /// If `padded` is set, the caller guarantees that `qson[length]` is readable; if it is a null character, the QSON
+        ///   is decoded in place
+        /// Otherwise, the QSON is first copied into an internal buffer, which is reused between loads
+        /// @param qson encoded QSON to load
+        /// @param length number of characters in the QSON
+        /// @param padded whether `qson[length]` is readable
+        ///
+        void load(const char * qson, u64 length, bool padded = false);
+        void load(std::string_view qson) { load(qson.data(), qson.size()); }
+
+        ///
+        /// Memory maps the given QCON file read-only and loads it, overriding any existing state
+        /// The file is decoded in place without being read into memory up front, and stays mapped until the next load
+        ///   or until the decoder is destroyed
+        /// If the file could not be opened or mapped, the state is set to `error`
+        /// @param path path of the QCON file to load
+        ///
+        void loadFile(const std::filesystem::path & path);
 
         ///
         /// Decode the next QCON unit, which could be a value, key-value pair, container start, or container end
@@ -103,6 +308,54 @@ namespace qcon
         ///
         DecodeState step();
 
+        ///
+        /// Skip the next value, which may be a whole object or array, without decoding it
+        /// Only the structure is followed; strings are not unescaped, numbers are not parsed, and the contents are
+        ///   otherwise not validated
+        /// Expects a value exactly like `operator>>`, so within an object, the key must be decoded first
+        /// @return current state; `skipped` if successful; `error` if there was an error
+        ///
+        DecodeState skip();
+
+        ///
+        /// Finds where to split the remaining elements of the current array into runs of roughly the given length, such
+        ///   that each run may be decoded separately, such as on separate threads, using `seekElement`
+        /// Only the structure is scanned for, jumping over strings and comments, so this is much faster than decoding or
+        ///   even skipping the elements; the elements are not validated, and the decoder does not move
+        /// Must be within an array, directly before an element or the end
+        /// @param runLength minimum number of characters in each run but the last
+        /// @return position of the first element of each run; empty if there are no more elements or if not in an array
+        ///
+        [[nodiscard]] std::vector<const char *> splitElements(u64 runLength) const;
+
+        ///
+        /// Moves directly to the given element of the current array, as if all elements before it had been decoded
+        /// @param element position of an element of the current array, such as from `splitElements` or `position`
+        ///
+        void seekElement(const char * element);
+
+        ///
+        /// Moves on to the next document of a document stream, once the current document has been fully decoded
+        /// Every document, including the first, should be preceded by a call to this
+        /// @return whether there is another document to decode; false at the end of the QCON or if there was an error
+        ///
+        [[nodiscard]] bool nextDocument();
+
+        ///
+        /// Finds where to split the remaining documents of a document stream into runs of roughly the given length, like
+        ///   `splitElements`, such that each run may be decoded separately using `seekDocument`
+        /// Must be between documents
+        /// @param runLength minimum number of characters in each run but the last
+        /// @return position of the first document of each run; empty if there are no more documents
+        ///
+        [[nodiscard]] std::vector<const char *> splitDocuments(u64 runLength) const;
+
+        ///
+        /// Moves directly to the given document of a document stream, as if all documents before it had been decoded
+        /// @param document position of a document, such as from `splitDocuments` or `position`
+        ///
+        void seekDocument(const char * document);
+
         ///
         /// If at root, returns whether the value has yet to be consumed
         /// If at the end of a container, consumes the end brace/bracket and returns false
@@ -127,7 +380,7 @@ namespace qcon
         ///
         Decoder & operator>>(Container container);
         Decoder & operator>>(std::string & v);
-        Decoder & operator>>(std::string_view &) = delete;
+        Decoder & operator>>(std::string_view & v); /// Follows `zeroCopy`; valid until the next decode
         Decoder & operator>>(char *) = delete;
         Decoder & operator>>(const char *) = delete;
         Decoder & operator>>(char &); /// Expects a single character string
@@ -148,6 +401,25 @@ namespace qcon
         Decoder & operator>>(Timepoint & v);
         Decoder & operator>>(nullptr_t);
 
+        ///
+        /// Determines what the next unit is from its first characters, without decoding it or changing any state
+        /// Numbers are looked at up to the end of their leading digits to tell integers from floaters, and dates up to
+        ///   where a time would follow
+        /// @return the state `step` would yield next if the unit is valid; `error` if the state is already `error`, if
+        ///   there is nothing more to decode, or if the unit is not recognized
+        ///
+        [[nodiscard]] DecodeState peekType() const;
+
+        ///
+        /// Attempts to decode a value of the given type exactly like `operator>>`, except that if it fails, whether
+        ///   because the value is of another type or is invalid, the decoder is left exactly as it was rather than put
+        ///   into the `error` state
+        /// `error` and `errorMessage` still describe why the value could not be decoded
+        /// @param v destination for the decoded value, or container to start or end; unspecified on failure
+        /// @return whether the value was decoded
+        ///
+        template <typename T> [[nodiscard]] bool tryRead(T && v);
+
         ///
         /// @return current state
         ///
@@ -158,18 +430,55 @@ namespace qcon
         ///
         const char * position() const { return _pos; }
 
+        ///
+        /// @return end of the QCON string if it was loaded with a length, such as from a file, otherwise null
+        ///
+        const char * endPosition() const { return _end; }
+
+        ///
+        /// @return the kind of the most recent error; `none` if there has been none since loading
+        ///
+        [[nodiscard]] ErrorCode error() const { return _error; }
+
+        ///
+        /// @return offset into the QCON of the position at which the most recent error occurred
+        ///
+        [[nodiscard]] u64 errorOffset() const { return _errorOffset; }
+
+        ///
+        /// Describes the most recent error
+        /// The description is only built here, so an error costs no more than recording its code and offset
+        /// @return brief description of the most recent error; empty if there has been none since loading
+        ///
+        [[nodiscard]] std::string errorMessage() const;
+
       private:
 
+        friend class PushDecoder;
+        friend class OnDemand;
+
         DecodeState _state;
         const char * _qcon;
         const char * _pos;
-        u64 _stack;
+        u64 _stack; // Innermost 64 levels of containers, one bit each, set for objects
         u64 _depth;
-        const char * _cachedEnd; // Only used for floating point `from_chars`
+        std::vector<u64> _stackSpill; // Outer levels of containers, 64 per element, if deeper than 64
+        const char * _end; // Only set for bounded QCON strings
         bool _hadComma;
+        std::vector<char> _buffer; // Null terminated copy of bounded QCON strings that could not be decoded in place
+        _MappedFile _file; // Mapping of the file being decoded, if any
+        u64 _discarded; // Length of input preceding `_qcon` that is no longer retained, for error offsets
+        ErrorCode _error;
+        u64 _errorOffset;
+        u64 _errorValue; // Character or count described by the error message, if any
+        std::string_view _errorText; // Characters described by the error message, if any; always a literal
 
         void _reset();
 
+        void _setError(ErrorCode error, u64 value = 0u);
+
+        void _rebaseViews(const Decoder & other);
+
         void _skipSpace();
 
         void _skipSpaceAndComments();
@@ -197,6 +506,8 @@ namespace qcon
 
         bool _tryConsumeDecimalDigits(u64 digits, u64 & dst);
 
+        u64 _consumeDecimalDigitBlock(u64 & dst);
+
         bool _tryConsumeHexDigits(u64 digits, u64 & dst);
 
         [[nodiscard]] bool _consumeChar(char c);
@@ -211,9 +522,9 @@ namespace qcon
 
         [[nodiscard]] bool _consumeEscaped(std::string & dst);
 
-        [[nodiscard]] bool _consumeString(std::string & dst);
+        [[nodiscard]] bool _consumeString(std::string & dst, std::string_view & view);
 
-        [[nodiscard]] bool _consumeKey(std::string & dst);
+        [[nodiscard]] bool _consumeKey(std::string & dst, std::string_view & view);
 
         [[nodiscard]] bool _consumeBinaryInteger(u64 & dst);
 
@@ -223,9 +534,9 @@ namespace qcon
 
         [[nodiscard]] bool _consumeHexInteger(u64 & dst);
 
-        [[nodiscard]] bool _consumeInteger(s64 & dst);
+        [[nodiscard]] DecodeState _consumeNumber(s64 & integerDst, f64 & floaterDst);
 
-        [[nodiscard]] bool _consumeFloater(f64 & dst);
+        [[nodiscard]] bool _consumeFloater(f64 & dst, const char * start, u64 significand);
 
         [[nodiscard]] bool _consumeDate(Date & dst);
 
@@ -241,10 +552,292 @@ namespace qcon
 
         void _ingestValue();
 
+        [[nodiscard]] bool _skipString();
+
+        [[nodiscard]] bool _skipValue();
+
+        [[nodiscard]] std::vector<const char *> _splitRuns(u64 runLength, bool documents) const;
+
+        [[nodiscard]] bool _streamString(std::string & dst, std::string_view & view);
+
         template <typename T> void _streamSmallerSignedInteger(T & v);
 
         template <typename T> void _streamSmallerUnsignedInteger(T & v);
     };
+
+    ///
+    /// Class to facilitate incremental QCON SAX decoding of input that arrives in chunks
+    /// Chunks of any size may be fed as they arrive, and decoded values are extracted in sequence exactly as with
+    ///   `Decoder::step`
+    /// Input is only decoded once the unit containing it is complete, so no token is ever split across chunks
+    /// Only undecoded input is retained, so memory use is bounded by the largest unit rather than the whole QCON
+    ///
+    class PushDecoder : private Decoder
+    {
+      public:
+
+        using Decoder::key;
+        using Decoder::string;
+        using Decoder::keyView;    /// Additionally invalidated by the next `feed`
+        using Decoder::stringView; /// Additionally invalidated by the next `feed`
+        using Decoder::integer;
+        using Decoder::floater;
+        using Decoder::positive;
+        using Decoder::boolean;
+        using Decoder::datetime;
+        using Decoder::date;
+        using Decoder::time;
+        using Decoder::zeroCopy;
+        using Decoder::maxDepth;
+
+        PushDecoder();
+
+        PushDecoder(const PushDecoder &) = delete;
+        PushDecoder(PushDecoder &&) = delete;
+
+        PushDecoder & operator=(const PushDecoder &) = delete;
+        PushDecoder & operator=(PushDecoder &&) = delete;
+
+        using Decoder::operator bool;
+
+        using Decoder::error;
+        using Decoder::errorOffset; /// Counts all input fed, including that already discarded
+        using Decoder::errorMessage;
+
+        ///
+        /// Appends the next chunk of QCON
+        /// @param chunk next chunk of QCON; may end anywhere, including in the middle of a token
+        ///
+        void feed(std::string_view chunk);
+
+        ///
+        /// Indicates that no more input is coming, making the remainder of the QCON available
+        ///
+        void close();
+
+        ///
+        /// @return whether `step` may be called, i.e. whether enough input has been fed to decode the next unit
+        ///
+        [[nodiscard]] bool available();
+
+        ///
+        /// Decode the next QCON unit, exactly like `Decoder::step`
+        /// Must only be called while `available` is true; otherwise yields an error
+        /// @return current state; `error` if there was an error
+        ///
+        DecodeState step();
+
+        using Decoder::finished;
+
+        using Decoder::state;
+
+      private:
+
+        enum class _Lexeme : u8
+        {
+            space,   // Between tokens
+            string,  // Within a string
+            escape,  // Following a backslash within a string
+            comment  // Within a comment
+        };
+
+        std::vector<char> _input{};
+        u64 _scanned{};           // Index of the first unscanned character
+        u64 _cut{};               // Index up to which input may be decoded; zero until there is a complete unit
+        char _cutChar{};          // Character displaced by the null terminator written at `_cut`
+        _Lexeme _lexeme{};        // Lexical state of the scan at `_scanned`
+        char _lastSignificant{};  // Last scanned character outside of strings, comments, and space
+        bool _boundaryPending{};  // Whether a unit has ended since `_lastSignificant`
+        bool _loaded{};           // Whether the underlying decoder has been loaded
+        bool _closed{};           // Whether all input has been fed
+
+        void _scan();
+
+        void _setCut(u64 cut);
+    };
+
+    ///
+    /// Offsets of the structural characters of a QCON string, found in a single vectorized pass
+    /// These are `{`, `}`, `[`, `]`, `:`, and `,`, the opening `"` of every string, and the first character of every
+    ///   other value
+    /// Strings concatenated onto the string before them do not get an offset of their own
+    /// Anything within strings and comments is ignored
+    /// The QCON is not validated
+    ///
+    class StructuralIndex
+    {
+      public:
+
+        StructuralIndex() = default;
+
+        ///
+        /// Constructs an index of the given QCON string
+        /// Equivalent to `StructuralIndex i{}; i.build(qcon)`
+        ///
+        explicit StructuralIndex(std::string_view qcon);
+
+        ///
+        /// Indexes the given QCON string, replacing any existing offsets
+        /// Storage is reused between builds
+        /// @param qcon QCON to index; need not be null terminated
+        /// @return whether the QCON could be indexed, which requires its length to fit in a `u32`
+        ///
+        bool build(std::string_view qcon);
+
+        ///
+        /// Indexes the next piece of a QCON string too large to index at once, as if it directly followed the last piece,
+        ///   replacing any existing offsets with ones relative to the start of this piece
+        /// Every piece but the last must have a length that is a multiple of 64
+        /// @param qcon next piece of the QCON to index; need not be null terminated
+        /// @return whether the piece could be indexed, which requires its length to fit in a `u32`
+        ///
+        bool buildNext(std::string_view qcon);
+
+        ///
+        /// @return the offsets of the structural characters, in ascending order
+        ///
+        [[nodiscard]] const std::vector<u32> & offsets() const { return _offsets; }
+
+        ///
+        /// @return whether the QCON ended within a string
+        ///
+        [[nodiscard]] bool unterminatedString() const { return _inString; }
+
+      private:
+
+        std::vector<u32> _offsets{};
+
+        // State carried between blocks and pieces
+        bool _inString{};
+        bool _inComment{};
+        bool _escapeCarry{};     // Whether the last character of the previous block was an unescaped backslash
+        bool _afterString{};     // Whether the last significant character was a closing quote
+        u64 _scalarCarry{};      // Whether the last character of the previous block was part of a scalar
+        u64 _plainScalarCarry{}; // Same, excluding colons
+    };
+
+    class OnDemand;
+
+    ///
+    /// A value within an `OnDemand` document, identified by its position in the QCON
+    /// Navigating or decoding a value that could not be found yields empty; see `OnDemand::error` for why
+    /// Only valid for as long as its document
+    ///
+    class OnDemandValue
+    {
+      public:
+
+        ///
+        /// Finds the member of this object with the given key, jumping over the values of preceding members
+        /// @param key key of the member to find
+        /// @return the value of the member
+        ///
+        [[nodiscard]] OnDemandValue operator[](std::string_view key) const;
+
+        ///
+        /// Finds the element of this array at the given index, jumping over preceding elements
+        /// @param i index of the element to find
+        /// @return the element
+        ///
+        [[nodiscard]] OnDemandValue operator[](u64 i) const;
+
+        ///
+        /// Decodes this value as the given type, exactly like `Decoder::operator>>`
+        /// Any of the decoder's value types may be used; a `std::string_view` follows `zeroCopy` as with the decoder,
+        ///   and may be invalidated by the next decode
+        /// @return decoded value, or empty if this value could not be found or is not of the given type
+        ///
+        template <typename T> [[nodiscard]] std::optional<T> get() const;
+
+        ///
+        /// @return whether this value was found
+        ///
+        explicit operator bool() const { return _pos; }
+
+      private:
+
+        OnDemand * _doc{};
+        const char * _pos{}; // Null if the value could not be found
+
+        OnDemandValue(OnDemand * doc, const char * pos);
+
+        friend OnDemand;
+    };
+
+    ///
+    /// Class to facilitate lazily reading select values out of a QCON string without decoding the rest
+    /// Navigating to a value jumps over everything before it exactly like `Decoder::skip`, and only the value itself is
+    ///   ever decoded, so the cost of a lookup depends on the position of the value rather than the size of the QCON
+    /// Values may be navigated to in any order and any number of times
+    /// The QCON is not validated beyond what is needed to reach and decode the requested values
+    ///
+    class OnDemand : private Decoder
+    {
+      public:
+
+        using Decoder::zeroCopy; /// Set by default
+
+        ///
+        /// Describe why the most recent navigation or decode failed
+        ///
+        using Decoder::error;
+        using Decoder::errorOffset;
+        using Decoder::errorMessage;
+
+        OnDemand();
+
+        OnDemand(const OnDemand &) = delete;
+        OnDemand(OnDemand && other) = default;
+
+        OnDemand & operator=(const OnDemand &) = delete;
+        OnDemand & operator=(OnDemand && other) = default;
+
+        ///
+        /// Constructs a document of the given QCON string, which must outlive it
+        /// See the corresponding `Decoder` constructors
+        ///
+        OnDemand(const char * qcon);
+        OnDemand(const std::string & qcon) : OnDemand{qcon.c_str()} {}
+        OnDemand(std::string &&) = delete; // Prevent binding to temporary
+        OnDemand(const char * qcon, u64 length, bool padded = false);
+        OnDemand(std::string_view qcon) : OnDemand{qcon.data(), qcon.size()} {}
+
+        using Decoder::load;
+        using Decoder::loadFile;
+
+        ///
+        /// @return the root value
+        ///
+        [[nodiscard]] OnDemandValue root();
+
+        ///
+        /// Convenience shorthands for `root()[...]`
+        ///
+        [[nodiscard]] OnDemandValue operator[](std::string_view key) { return root()[key]; }
+        [[nodiscard]] OnDemandValue operator[](u64 i) { return root()[i]; }
+
+      private:
+
+        [[nodiscard]] bool _skipSeparator(char closer);
+
+        [[nodiscard]] const char * _findMember(const char * pos, std::string_view name);
+
+        [[nodiscard]] const char * _findElement(const char * pos, u64 i);
+
+        template <typename T> [[nodiscard]] std::optional<T> _get(const char * pos);
+
+        friend OnDemandValue;
+    };
+
+    ///
+    /// Decodes an object into the struct according to its `Binding`
+    /// Keys are matched by a perfect hash generated at compile time, costing a single comparison per key
+    /// Keys without a field are skipped, and fields without a key are left as they were
+    /// @param decoder decoder to decode from
+    /// @param v struct to decode into
+    /// @return the decoder
+    ///
+    template <Bound T> Decoder & operator>>(Decoder & decoder, T & v);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -291,63 +884,430 @@ namespace qcon
         }
     }
 
-    [[nodiscard]] inline bool _isFloater(const char * str)
+  #if defined(QCON_ASAN)
+    inline constexpr bool _blockReads{false};
+  #else
+    inline constexpr bool _blockReads{true};
+  #endif
+
+  #if defined(QCON_SSE2)
+
+    #if defined(QCON_AVX2)
+    using _SimdBlock = __m256i;
+    inline constexpr u64 _simdWidth{32u};
+    [[nodiscard]] inline _SimdBlock _simdLoad(const char * const p) { return _mm256_load_si256(reinterpret_cast<const __m256i *>(p)); }
+    [[nodiscard]] inline _SimdBlock _simdLoadUnaligned(const char * const p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+    [[nodiscard]] inline _SimdBlock _simdSplat(const char c) { return _mm256_set1_epi8(c); }
+    [[nodiscard]] inline _SimdBlock _simdEq(const _SimdBlock b, const char c) { return _mm256_cmpeq_epi8(b, _mm256_set1_epi8(c)); }
+    [[nodiscard]] inline _SimdBlock _simdLe(const _SimdBlock b, const u8 c) { return _mm256_cmpeq_epi8(_mm256_min_epu8(b, _mm256_set1_epi8(char(c))), b); }
+    [[nodiscard]] inline _SimdBlock _simdRange(const _SimdBlock b, const char lo, const char hi) { return _simdLe(_mm256_sub_epi8(b, _mm256_set1_epi8(lo)), u8(hi - lo)); }
+    [[nodiscard]] inline _SimdBlock _simdOr(const _SimdBlock a, const _SimdBlock b) { return _mm256_or_si256(a, b); }
+    [[nodiscard]] inline u32 _simdMask(const _SimdBlock b) { return u32(_mm256_movemask_epi8(b)); }
+    [[nodiscard]] inline u32 _simdInverseMask(const _SimdBlock b) { return ~_simdMask(b); }
+    #else
+    using _SimdBlock = __m128i;
+    inline constexpr u64 _simdWidth{16u};
+    [[nodiscard]] inline _SimdBlock _simdLoad(const char * const p) { return _mm_load_si128(reinterpret_cast<const __m128i *>(p)); }
+    [[nodiscard]] inline _SimdBlock _simdLoadUnaligned(const char * const p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+    [[nodiscard]] inline _SimdBlock _simdSplat(const char c) { return _mm_set1_epi8(c); }
+    [[nodiscard]] inline _SimdBlock _simdEq(const _SimdBlock b, const char c) { return _mm_cmpeq_epi8(b, _mm_set1_epi8(c)); }
+    [[nodiscard]] inline _SimdBlock _simdLe(const _SimdBlock b, const u8 c) { return _mm_cmpeq_epi8(_mm_min_epu8(b, _mm_set1_epi8(char(c))), b); }
+    [[nodiscard]] inline _SimdBlock _simdRange(const _SimdBlock b, const char lo, const char hi) { return _simdLe(_mm_sub_epi8(b, _mm_set1_epi8(lo)), u8(hi - lo)); }
+    [[nodiscard]] inline _SimdBlock _simdOr(const _SimdBlock a, const _SimdBlock b) { return _mm_or_si128(a, b); }
+    [[nodiscard]] inline u32 _simdMask(const _SimdBlock b) { return u32(_mm_movemask_epi8(b)); }
+    [[nodiscard]] inline u32 _simdInverseMask(const _SimdBlock b) { return ~_simdMask(b) & 0xFFFFu; }
+    #endif
+
+    ///
+    /// Finds the first character at or after `pos` that `matchMask` flags
+    /// Loads never cross a page boundary, which makes it safe to read past the null terminator; `matchMask` must
+    ///   therefore flag the null terminator
+    ///
+    template <typename MatchMask>
+    [[nodiscard]] inline const char * _simdFind(const char * const pos, const MatchMask matchMask)
     {
-        while (_private::isDigit(*str)) ++str;
-        if (*str == '.')
+        static constexpr u64 pageSize{4096u};
+
+        const u64 address{u64(reinterpret_cast<std::uintptr_t>(pos))};
+        const char * block;
+
+        // Start with a block at `pos` so short runs resolve in one load, unless it would cross into the next page
+        if ((address & (pageSize - 1u)) <= pageSize - _simdWidth)
         {
-            return _private::isDigit(str[1]);
+            if (const u32 mask{matchMask(_simdLoadUnaligned(pos))}; mask)
+            {
+                return pos + std::countr_zero(mask);
+            }
+
+            block = pos + _simdWidth - ((address + _simdWidth) & (_simdWidth - 1u));
         }
-        else if (*str == 'e' || *str == 'E')
+        // Otherwise start with the aligned block containing `pos`, ignoring the bits before `pos`
+        else
         {
-            return true;
+            const u64 offset{address & (_simdWidth - 1u)};
+            block = pos - offset;
+
+            if (const u32 mask{matchMask(_simdLoad(block)) >> offset}; mask)
+            {
+                return pos + std::countr_zero(mask);
+            }
+
+            block += _simdWidth;
         }
-        else
+
+        // Continue with aligned blocks, which never cross a page boundary
+        while (true)
         {
-            return false;
+            if (const u32 mask{matchMask(_simdLoad(block))}; mask)
+            {
+                return block + std::countr_zero(mask);
+            }
+
+            block += _simdWidth;
         }
     }
 
-    inline Decoder::Decoder()
+  #endif
+
+    ///
+    /// @return the first `"`, `\`, or control character (including the null terminator) at or after `pos`
+    ///
+    [[nodiscard]] inline const char * _findStringSpecial(const char * pos)
     {
-        _reset();
+      #if defined(QCON_SSE2)
+        return _simdFind(pos, [](const _SimdBlock b)
+        {
+            return _simdMask(_simdOr(_simdOr(_simdEq(b, '"'), _simdEq(b, '\\')), _simdLe(b, 31u)));
+        });
+      #else
+        while (*pos != '"' && *pos != '\\' && !_private::isControl(*pos)) ++pos;
+        return pos;
+      #endif
     }
 
-    inline Decoder::Decoder(Decoder && other) :
-        key{std::move(other.key)},
-        string{std::move(other.string)},
-        errorMessage{std::move(other.errorMessage)},
-
-        _state{other._state},
-        _qcon{other._qcon},
-        _pos{other._pos},
-        _stack{other._stack},
-        _depth{other._depth},
-        _cachedEnd{other._cachedEnd},
-        _hadComma{other._hadComma}
+    ///
+    /// @return the first non-whitespace character at or after `pos`
+    ///
+    [[nodiscard]] QCON_NOINLINE inline const char * _findNonSpace(const char * pos)
     {
-        other._reset();
+      #if defined(QCON_SSE2)
+        return _simdFind(pos, [](const _SimdBlock b)
+        {
+            // `\t`, `\n`, `\v`, `\f`, and `\r` are contiguous
+            return _simdInverseMask(_simdOr(_simdRange(b, '\t', '\r'), _simdEq(b, ' ')));
+        });
+      #else
+        while (_isSpace(*pos)) ++pos;
+        return pos;
+      #endif
     }
 
-    inline Decoder & Decoder::operator=(Decoder && other)
+    ///
+    /// @return the first `\n` or null terminator at or after `pos`
+    ///
+    [[nodiscard]] QCON_NOINLINE inline const char * _findLineEnd(const char * pos)
     {
-        if (&other == this)
+      #if defined(QCON_SSE2)
+        return _simdFind(pos, [](const _SimdBlock b)
         {
-            return *this;
-        }
+            return _simdMask(_simdOr(_simdEq(b, '\n'), _simdEq(b, '\0')));
+        });
+      #else
+        while (*pos && *pos != '\n') ++pos;
+        return pos;
+      #endif
+    }
+
+    ///
+    /// @return the first `{`, `}`, `[`, `]`, `"`, `#`, or null terminator at or after `pos`
+    ///
+    [[nodiscard]] inline const char * _findStructural(const char * pos)
+    {
+      #if defined(QCON_SSE2)
+        return _simdFind(pos, [](const _SimdBlock b)
+        {
+            const _SimdBlock brackets{_simdOr(_simdOr(_simdEq(b, '{'), _simdEq(b, '}')), _simdOr(_simdEq(b, '['), _simdEq(b, ']')))};
+            return _simdMask(_simdOr(brackets, _simdOr(_simdOr(_simdEq(b, '"'), _simdEq(b, '#')), _simdEq(b, '\0'))));
+        });
+      #else
+        while (true)
+        {
+            switch (*pos)
+            {
+                case '{': [[fallthrough]];
+                case '}': [[fallthrough]];
+                case '[': [[fallthrough]];
+                case ']': [[fallthrough]];
+                case '"': [[fallthrough]];
+                case '#': [[fallthrough]];
+                case '\0': return pos;
+                default: ++pos;
+            }
+        }
+      #endif
+    }
+
+    ///
+    /// Bit masks of the characters of a 64 character block that matter to `StructuralIndex`, one bit per character
+    ///
+    struct _BlockMasks
+    {
+        u64 quote;
+        u64 backslash;
+        u64 hash;
+        u64 newline;
+        u64 space;
+        u64 structural;
+        u64 colon;
+    };
+
+    [[nodiscard]] inline _BlockMasks _classifyBlock(const char * const block)
+    {
+        _BlockMasks masks{};
+
+      #if defined(QCON_SSE2)
+        for (u64 i{0u}; i < 64u; i += _simdWidth)
+        {
+            const _SimdBlock b{_simdLoadUnaligned(block + i)};
+            // `[` and `]` differ from `{` and `}` only by bit 5
+            const _SimdBlock braced{_simdOr(b, _simdSplat(0x20))};
+            const _SimdBlock brackets{_simdOr(_simdEq(braced, '{'), _simdEq(braced, '}'))};
+            masks.quote |= u64(_simdMask(_simdEq(b, '"'))) << i;
+            masks.backslash |= u64(_simdMask(_simdEq(b, '\\'))) << i;
+            masks.hash |= u64(_simdMask(_simdEq(b, '#'))) << i;
+            masks.newline |= u64(_simdMask(_simdEq(b, '\n'))) << i;
+            masks.space |= u64(_simdMask(_simdOr(_simdRange(b, '\t', '\r'), _simdEq(b, ' ')))) << i;
+            const _SimdBlock colons{_simdEq(b, ':')};
+            masks.structural |= u64(_simdMask(_simdOr(brackets, _simdOr(colons, _simdEq(b, ','))))) << i;
+            masks.colon |= u64(_simdMask(colons)) << i;
+        }
+      #else
+        for (u64 i{0u}; i < 64u; ++i)
+        {
+            const u64 bit{u64(1u) << i};
+            switch (block[i])
+            {
+                case '"': masks.quote |= bit; break;
+                case '\\': masks.backslash |= bit; break;
+                case '#': masks.hash |= bit; break;
+                case '\n': masks.newline |= bit; [[fallthrough]];
+                case '\t': [[fallthrough]];
+                case '\v': [[fallthrough]];
+                case '\f': [[fallthrough]];
+                case '\r': [[fallthrough]];
+                case ' ': masks.space |= bit; break;
+                case '{': [[fallthrough]];
+                case '}': [[fallthrough]];
+                case '[': [[fallthrough]];
+                case ']': [[fallthrough]];
+                case ',': masks.structural |= bit; break;
+                case ':': masks.structural |= bit; masks.colon |= bit; break;
+                default: break;
+            }
+        }
+      #endif
+
+        return masks;
+    }
+
+    ///
+    /// @return mask where each bit is the parity of the set bits of `x` at or below it
+    ///
+    [[nodiscard]] inline u64 _prefixXor(u64 x)
+    {
+        x ^= x << 1;
+        x ^= x << 2;
+        x ^= x << 4;
+        x ^= x << 8;
+        x ^= x << 16;
+        x ^= x << 32;
+        return x;
+    }
+
+    inline _MappedFile::_MappedFile(_MappedFile && other) :
+        _data{std::exchange(other._data, nullptr)},
+        _size{std::exchange(other._size, 0u)}
+    {}
+
+    inline _MappedFile & _MappedFile::operator=(_MappedFile && other)
+    {
+        if (&other != this)
+        {
+            unmap();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0u);
+        }
+
+        return *this;
+    }
+
+    inline _MappedFile::~_MappedFile()
+    {
+        unmap();
+    }
+
+    inline bool _MappedFile::map(const std::filesystem::path & path)
+    {
+        unmap();
+
+      #if defined(_WIN32)
+        const HANDLE file{CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr)};
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || !size.QuadPart)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        const HANDLE mapping{CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr)};
+        CloseHandle(file);
+        if (!mapping)
+        {
+            return false;
+        }
+
+        const void * const data{MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)};
+        CloseHandle(mapping);
+        if (!data)
+        {
+            return false;
+        }
+
+        _data = static_cast<const char *>(data);
+        _size = u64(size.QuadPart);
+      #else
+        const int file{open(path.c_str(), O_RDONLY)};
+        if (file == -1)
+        {
+            return false;
+        }
+
+        struct stat info;
+        if (fstat(file, &info) || !info.st_size)
+        {
+            close(file);
+            return false;
+        }
+
+        void * const data{mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_PRIVATE, file, 0)};
+        close(file);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        // Decoding is a single forward pass
+        madvise(data, size_t(info.st_size), MADV_SEQUENTIAL);
+
+        _data = static_cast<const char *>(data);
+        _size = u64(info.st_size);
+      #endif
+
+        return true;
+    }
+
+    inline void _MappedFile::unmap()
+    {
+        if (_data)
+        {
+          #if defined(_WIN32)
+            UnmapViewOfFile(_data);
+          #else
+            munmap(const_cast<char *>(_data), _size);
+          #endif
+
+            _data = nullptr;
+            _size = 0u;
+        }
+    }
+
+    inline u64 _MappedFile::_pageSize()
+    {
+      #if defined(_WIN32)
+        static const u64 pageSize{[]()
+        {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return u64(info.dwPageSize);
+        }()};
+      #else
+        static const u64 pageSize{u64(sysconf(_SC_PAGESIZE))};
+      #endif
+
+        return pageSize;
+    }
+
+    inline Decoder::Decoder()
+    {
+        _reset();
+    }
+
+    inline Decoder::Decoder(Decoder && other) :
+        key{std::move(other.key)},
+        string{std::move(other.string)},
+        keyView{other.keyView},
+        stringView{other.stringView},
+        zeroCopy{other.zeroCopy},
+        maxDepth{other.maxDepth},
+        documentStream{other.documentStream},
+
+        _state{other._state},
+        _qcon{other._qcon},
+        _pos{other._pos},
+        _stack{other._stack},
+        _depth{other._depth},
+        _stackSpill{std::move(other._stackSpill)},
+        _end{other._end},
+        _hadComma{other._hadComma},
+        _buffer{std::move(other._buffer)},
+        _file{std::move(other._file)},
+        _discarded{other._discarded},
+        _error{other._error},
+        _errorOffset{other._errorOffset},
+        _errorValue{other._errorValue},
+        _errorText{other._errorText}
+    {
+        _rebaseViews(other);
+        other._reset();
+    }
+
+    inline Decoder & Decoder::operator=(Decoder && other)
+    {
+        if (&other == this)
+        {
+            return *this;
+        }
 
         key = std::move(other.key);
         string = std::move(other.string);
-        errorMessage = std::move(other.errorMessage);
+        keyView = other.keyView;
+        stringView = other.stringView;
+        zeroCopy = other.zeroCopy;
+        maxDepth = other.maxDepth;
+        documentStream = other.documentStream;
 
         _state = other._state;
         _qcon = other._qcon;
         _pos = other._pos;
         _stack = other._stack;
         _depth = other._depth;
-        _cachedEnd = other._cachedEnd;
+        _stackSpill = std::move(other._stackSpill);
+        _end = other._end;
         _hadComma = other._hadComma;
-
+        _buffer = std::move(other._buffer);
+        _file = std::move(other._file);
+        _discarded = other._discarded;
+        _error = other._error;
+        _errorOffset = other._errorOffset;
+        _errorValue = other._errorValue;
+        _errorText = other._errorText;
+
+        _rebaseViews(other);
         other._reset();
 
         return *this;
@@ -358,6 +1318,11 @@ namespace qcon
         load(qcon);
     }
 
+    inline Decoder::Decoder(const char * const qcon, const u64 length, const bool padded)
+    {
+        load(qcon, length, padded);
+    }
+
     inline void Decoder::load(const char * const qcon)
     {
         _reset();
@@ -368,14 +1333,61 @@ namespace qcon
 
         _skipSpaceAndComments();
 
-        // QCON missing value
-        if (!*_pos)
+        // QCON missing value; a document stream may have no documents
+        if (!*_pos && !documentStream)
         {
-            errorMessage = "Expected value"sv;
+            _setError(ErrorCode::expectedValue);
             _state = DecodeState::error;
         }
     }
 
+    inline void Decoder::load(const char * const qcon, const u64 length, const bool padded)
+    {
+        // Decode in place if already null terminated, otherwise null terminate a copy
+        if (padded && !qcon[length])
+        {
+            load(qcon);
+        }
+        else
+        {
+            _buffer.assign(qcon, qcon + length);
+            _buffer.push_back('\0');
+            load(_buffer.data());
+        }
+
+        // An early null character must not be mistaken for the end
+        _end = _qcon + length;
+    }
+
+    inline void Decoder::loadFile(const std::filesystem::path & path)
+    {
+        _MappedFile file{};
+        if (!file.map(path))
+        {
+            // An empty file is valid to open but has no value
+            std::error_code error;
+            const bool empty{std::filesystem::is_regular_file(path, error) && std::filesystem::file_size(path, error) == 0u};
+
+            load("");
+            if (!empty)
+            {
+                _setError(ErrorCode::failedToOpenFile);
+                _state = DecodeState::error;
+            }
+
+            return;
+        }
+
+        // Mapped pages are zero-filled past the end of the file, so it can usually be decoded in place; otherwise it is
+        //   copied and the mapping released
+        const bool padded{file.padded()};
+        load(file.data(), file.size(), padded);
+        if (padded)
+        {
+            _file = std::move(file);
+        }
+    }
+
     inline DecodeState Decoder::step()
     {
         // Preserve error state
@@ -404,11 +1416,11 @@ namespace qcon
                         // Ensure there was a comma between elements
                         if (_state != DecodeState::object && !_hadComma)
                         {
-                            errorMessage = "Missing comma between object elements"sv;
+                            _setError(ErrorCode::missingObjectComma);
                             return _state = DecodeState::error;
                         }
 
-                        if (_consumeKey(key))
+                        if (_consumeKey(key, keyView))
                         {
                             _skipSpaceAndComments();
                             return _state = DecodeState::key;
@@ -432,16 +1444,123 @@ namespace qcon
                 // Ensure there was a comma between elements
                 if (_state != DecodeState::array && !_hadComma)
                 {
-                    errorMessage = "Missing comma between array elements"sv;
+                    _setError(ErrorCode::missingArrayComma);
                     return _state = DecodeState::error;
                 }
             }
         }
+        // Ensure the next document was moved on to
+        else if (documentStream && _state != DecodeState::ready)
+        {
+            _setError(ErrorCode::multipleRootValues);
+            return _state = DecodeState::error;
+        }
 
         _ingestValue();
         return _state;
     }
 
+    inline DecodeState Decoder::skip()
+    {
+        if (_preValueStreamCheck())
+        {
+            _postValue(_skipValue(), DecodeState::skipped);
+        }
+
+        return _state;
+    }
+
+    inline std::vector<const char *> Decoder::splitElements(const u64 runLength) const
+    {
+        if (_state == DecodeState::error || !_depth || (_stack & 1u) || *_pos == ']' || !*_pos)
+        {
+            return {};
+        }
+
+        return _splitRuns(runLength, false);
+    }
+
+    inline void Decoder::seekElement(const char * const element)
+    {
+        // Preserve error state
+        if (_state == DecodeState::error)
+        {
+            return;
+        }
+
+        if (!_depth || (_stack & 1u))
+        {
+            _setError(ErrorCode::expectedArray);
+            _state = DecodeState::error;
+            return;
+        }
+
+        // Starting the array likewise allows an element without a preceding comma
+        _pos = element;
+        _state = DecodeState::array;
+        _hadComma = false;
+    }
+
+    inline bool Decoder::nextDocument()
+    {
+        if (_state == DecodeState::error)
+        {
+            return false;
+        }
+
+        // The current document must be complete before moving on
+        if (_depth)
+        {
+            _setError(ErrorCode::unfinishedDocument);
+            _state = DecodeState::error;
+            return false;
+        }
+
+        if (!*_pos)
+        {
+            // An early null character must not be mistaken for the end
+            if (_end && _pos != _end)
+            {
+                _setError(ErrorCode::extraneousRootContent);
+                _state = DecodeState::error;
+            }
+
+            return false;
+        }
+
+        _state = DecodeState::ready;
+        return true;
+    }
+
+    inline std::vector<const char *> Decoder::splitDocuments(const u64 runLength) const
+    {
+        if (_state == DecodeState::error || _depth || !*_pos)
+        {
+            return {};
+        }
+
+        return _splitRuns(runLength, true);
+    }
+
+    inline void Decoder::seekDocument(const char * const document)
+    {
+        // Preserve error state
+        if (_state == DecodeState::error)
+        {
+            return;
+        }
+
+        if (_depth)
+        {
+            _setError(ErrorCode::unfinishedDocument);
+            _state = DecodeState::error;
+            return;
+        }
+
+        _pos = document;
+        _state = DecodeState::ready;
+    }
+
     inline bool Decoder::more()
     {
         // Preserve error state
@@ -477,7 +1596,61 @@ namespace qcon
 
     inline bool Decoder::finished() const
     {
-        return _state != DecodeState::error && _state != DecodeState::ready && !_depth && !*_pos;
+        return _state != DecodeState::error && _state != DecodeState::ready && !_depth && !*_pos && (!_end || _pos == _end);
+    }
+
+    inline std::string Decoder::errorMessage() const
+    {
+        switch (_error)
+        {
+            case ErrorCode::none: return {};
+            case ErrorCode::exceededMaxDepth: return std::format("Exceeded max depth of {}"sv, _errorValue);
+            case ErrorCode::expectedCharacter: return std::format("Expected `{}`"sv, char(_errorValue));
+            case ErrorCode::expectedCharacters: return std::format("Expected `{}`"sv, _errorText);
+            case ErrorCode::expectedDecimalDigits: return std::format("Expected {} decimal digits"sv, _errorValue);
+            case ErrorCode::expectedHexDigits: return std::format("Expected {} hex digits"sv, _errorValue);
+            case ErrorCode::failedToOpenFile: return std::string{"Failed to open file"sv};
+            case ErrorCode::expectedValue: return std::string{"Expected value"sv};
+            case ErrorCode::unknownValue: return std::string{"Unknown value"sv};
+            case ErrorCode::unexpectedEnd: return std::string{"Hit end of QCON"sv};
+            case ErrorCode::extraneousRootContent: return std::string{"Extraneous root content"sv};
+            case ErrorCode::multipleRootValues: return std::string{"Root may only have a single value"sv};
+            case ErrorCode::expectedKey: return std::string{"Expected key"sv};
+            case ErrorCode::expectedComma: return std::string{"Expected comma"sv};
+            case ErrorCode::missingObjectComma: return std::string{"Missing comma between object elements"sv};
+            case ErrorCode::missingArrayComma: return std::string{"Missing comma between array elements"sv};
+            case ErrorCode::moreElements: return std::string{"There are more elements in the container"sv};
+            case ErrorCode::expectedObject: return std::string{"Expected object"sv};
+            case ErrorCode::expectedArray: return std::string{"Expected array"sv};
+            case ErrorCode::expectedInteger: return std::string{"Expected integer"sv};
+            case ErrorCode::expectedFloater: return std::string{"Expected floater"sv};
+            case ErrorCode::expectedBoolean: return std::string{"Expected boolean"sv};
+            case ErrorCode::expectedSingleCharacter: return std::string{"Expected single character string"sv};
+            case ErrorCode::invalidStringContent: return std::string{"Invalid string content"sv};
+            case ErrorCode::invalidEscapeSequence: return std::string{"Invalid escape sequence"sv};
+            case ErrorCode::codepointTooLarge: return std::string{"Codepoint too large"sv};
+            case ErrorCode::missingBinaryDigit: return std::string{"Missing binary digit"sv};
+            case ErrorCode::missingOctalDigit: return std::string{"Missing octal digit"sv};
+            case ErrorCode::missingDecimalDigit: return std::string{"Missing decimal digit"sv};
+            case ErrorCode::missingHexDigit: return std::string{"Missing hex digit"sv};
+            case ErrorCode::negativeIntegerTooLarge: return std::string{"Negative integer too large"sv};
+            case ErrorCode::negativeUnsigned: return std::string{"Cannot decode negative value into unsigned integer"sv};
+            case ErrorCode::signedIntegerTooLarge: return std::string{"Signed integer too large"sv};
+            case ErrorCode::unsignedIntegerTooLarge: return std::string{"Unsigned integer too large"sv};
+            case ErrorCode::invalidFloater: return std::string{"Invalid floater"sv};
+            case ErrorCode::invalidMonth: return std::string{"Invalid month"sv};
+            case ErrorCode::invalidDay: return std::string{"Invalid day"sv};
+            case ErrorCode::invalidHour: return std::string{"Invalid hour"sv};
+            case ErrorCode::invalidMinute: return std::string{"Invalid minute"sv};
+            case ErrorCode::invalidSecond: return std::string{"Invalid second"sv};
+            case ErrorCode::missingKey: return std::string{"Missing key"sv};
+            case ErrorCode::indexOutOfRange: return std::string{"Index out of range"sv};
+            case ErrorCode::inputAlreadyClosed: return std::string{"Input already closed"sv};
+            case ErrorCode::insufficientInput: return std::string{"Insufficient input"sv};
+            case ErrorCode::unfinishedDocument: return std::string{"Unfinished document"sv};
+        }
+
+        return {};
     }
 
     inline Decoder & Decoder::operator>>(const Container container)
@@ -487,7 +1660,7 @@ namespace qcon
         {
             if (more())
             {
-                errorMessage = "There are more elements in the container"sv;
+                _setError(ErrorCode::moreElements);
                 _state = DecodeState::error;
             }
 
@@ -516,86 +1689,75 @@ namespace qcon
 
     inline Decoder & Decoder::operator>>(std::string & v)
     {
-        // Stream key
+        std::string_view view;
+        if (_streamString(v, view) && view.data() != v.data())
+        {
+            // String was viewed directly in the QCON, so copy it now
+            v = view;
+        }
+
+        return *this;
+    }
+
+    inline Decoder & Decoder::operator>>(std::string_view & v)
+    {
         const bool inObject{bool(_stack & 1u)};
-        if (inObject && _state != DecodeState::key)
+        const bool isKey{inObject && _state != DecodeState::key};
+
+        if (isKey ? _streamString(key, keyView) : _streamString(string, stringView))
         {
-            if (!_preKeyStreamCheck())
-            {
-                return *this;
-            }
+            v = isKey ? keyView : stringView;
+        }
+
+        return *this;
+    }
+
+    inline Decoder & Decoder::operator>>(char & v)
+    {
+        std::string_view view;
 
-            if (_consumeKey(v))
+        if (*this >> view)
+        {
+            if (view.size() == 1u)
             {
-                _state = DecodeState::key;
-                _skipSpaceAndComments();
+                v = view.front();
             }
             else
             {
+                _setError(ErrorCode::expectedSingleCharacter);
                 _state = DecodeState::error;
             }
+        }
+
+        return *this;
+    }
 
+    inline Decoder & Decoder::operator>>(s64 & v)
+    {
+        if (!_preValueStreamCheck())
+        {
             return *this;
         }
-        // Stream value
-        else
-        {
-            if (!_preValueStreamCheck())
-            {
-                return *this;
-            }
-
-            if (_consumeChar('"'))
-            {
-                _postValue(_consumeString(v), DecodeState::string);
-            }
-            else
-            {
-                _state = DecodeState::error;
-            }
-
-            return *this;
-        }
-    }
 
-    inline Decoder & Decoder::operator>>(char & v)
-    {
-        const bool inObject{bool(_stack & 1u)};
-        const bool isKey{inObject && _state != DecodeState::key};
-        std::string & dst{isKey ? key : string};
+        positive = _tryConsumeSign() >= 0;
 
-        if (*this >> dst)
+        if (_private::isDigit(*_pos))
         {
-            if (dst.size() == 1u)
+            f64 floaterDst;
+            const DecodeState state{_consumeNumber(v, floaterDst)};
+            if (state == DecodeState::floater)
             {
-                v = dst.front();
+                _setError(ErrorCode::expectedInteger);
+                _state = DecodeState::error;
             }
             else
             {
-                errorMessage = "Expected single character string"sv;
-                _state = DecodeState::error;
+                _postValue(state == DecodeState::integer, DecodeState::integer);
             }
         }
-
-        return *this;
-    }
-
-    inline Decoder & Decoder::operator>>(s64 & v)
-    {
-        if (!_preValueStreamCheck())
-        {
-            return *this;
-        }
-
-        positive = _tryConsumeSign() >= 0;
-
-        if (_private::isDigit(*_pos) && !_isFloater(_pos + 1))
-        {
-            _postValue(_consumeInteger(v), DecodeState::integer);
-        }
         else
         {
-            errorMessage = "Expected integer"sv;
+            _setError(ErrorCode::expectedInteger);
             _state = DecodeState::error;
         }
 
@@ -617,13 +1779,55 @@ namespace qcon
         }
         else
         {
-            errorMessage = "Cannot decode negative value into unsigned integer"sv;
+            _setError(ErrorCode::negativeUnsigned);
             _state = DecodeState::error;
         }
 
         return *this;
     }
 
+    inline bool Decoder::_streamString(std::string & dst, std::string_view & view)
+    {
+        // Stream key
+        const bool inObject{bool(_stack & 1u)};
+        if (inObject && _state != DecodeState::key)
+        {
+            if (!_preKeyStreamCheck())
+            {
+                return false;
+            }
+
+            if (_consumeKey(dst, view))
+            {
+                _state = DecodeState::key;
+                _skipSpaceAndComments();
+            }
+            else
+            {
+                _state = DecodeState::error;
+            }
+        }
+        // Stream value
+        else
+        {
+            if (!_preValueStreamCheck())
+            {
+                return false;
+            }
+
+            if (_consumeChar('"'))
+            {
+                _postValue(_consumeString(dst, view), DecodeState::string);
+            }
+            else
+            {
+                _state = DecodeState::error;
+            }
+        }
+
+        return _state != DecodeState::error;
+    }
+
     template <typename T>
     inline void Decoder::_streamSmallerSignedInteger(T & v)
     {
@@ -640,7 +1844,7 @@ namespace qcon
         }
         else
         {
-            errorMessage = "Signed integer too large";
+            _setError(ErrorCode::signedIntegerTooLarge);
             _state = DecodeState::error;
         }
     }
@@ -658,7 +1862,7 @@ namespace qcon
         }
         else
         {
-            errorMessage = "Unsigned integer too large";
+            _setError(ErrorCode::unsignedIntegerTooLarge);
             _state = DecodeState::error;
         }
     }
@@ -708,9 +1912,19 @@ namespace qcon
 
         positive = _tryConsumeSign() >= 0;
 
-        if (_private::isDigit(*_pos) && _isFloater(_pos + 1))
+        if (_private::isDigit(*_pos))
         {
-            _postValue(_consumeFloater(v), DecodeState::floater);
+            s64 integerDst;
+            const DecodeState state{_consumeNumber(integerDst, v)};
+            if (state == DecodeState::integer)
+            {
+                _setError(ErrorCode::expectedFloater);
+                _state = DecodeState::error;
+            }
+            else
+            {
+                _postValue(state == DecodeState::floater, DecodeState::floater);
+            }
         }
         else if (_tryConsumeChars("inf"sv))
         {
@@ -724,7 +1938,7 @@ namespace qcon
         }
         else
         {
-            errorMessage = "Expected floater"sv;
+            _setError(ErrorCode::expectedFloater);
             _state = DecodeState::error;
         }
 
@@ -761,7 +1975,7 @@ namespace qcon
         }
         else
         {
-            errorMessage = "Expected boolean"sv;
+            _setError(ErrorCode::expectedBoolean);
             _state = DecodeState::error;
         }
 
@@ -826,6 +2040,117 @@ namespace qcon
         return *this;
     }
 
+    inline DecodeState Decoder::peekType() const
+    {
+        // Preserve error state
+        if (_state == DecodeState::error)
+        {
+            return DecodeState::error;
+        }
+
+        if (_depth)
+        {
+            const bool inObject{bool(_stack & 1u)};
+            if (inObject)
+            {
+                if (_state != DecodeState::key)
+                {
+                    return *_pos == '}' ? DecodeState::end : DecodeState::key;
+                }
+            }
+            else if (*_pos == ']')
+            {
+                return DecodeState::end;
+            }
+        }
+        else if (_state != DecodeState::ready)
+        {
+            return DecodeState::error;
+        }
+
+        const char * pos{_pos};
+        switch (*pos)
+        {
+            case '{': return DecodeState::object;
+            case '[': return DecodeState::array;
+            case '"': return DecodeState::string;
+            case 't': [[fallthrough]];
+            case 'f': return DecodeState::boolean;
+            case 'n': return pos[1] == 'a' ? DecodeState::floater : DecodeState::null;
+            case 'i': return DecodeState::floater;
+            case 'T': return DecodeState::time;
+            case 'D':
+            {
+                // A datetime continues with a time directly after the fixed width date
+                const char * const dateEnd{pos + 11};
+                for (++pos; pos < dateEnd && *pos; ++pos);
+                return *pos == 'T' ? DecodeState::datetime : DecodeState::date;
+            }
+            case '+': [[fallthrough]];
+            case '-':
+            {
+                ++pos;
+                if (*pos == 'i' || *pos == 'n')
+                {
+                    return DecodeState::floater;
+                }
+                else if (!_private::isDigit(*pos))
+                {
+                    return DecodeState::error;
+                }
+                break;
+            }
+            default:
+            {
+                if (!_private::isDigit(*pos))
+                {
+                    return DecodeState::error;
+                }
+                break;
+            }
+        }
+
+        // Prefixed numbers are always integers
+        if (*pos == '0' && (pos[1] == 'b' || pos[1] == 'o' || pos[1] == 'x'))
+        {
+            return DecodeState::integer;
+        }
+
+        // Otherwise it is only a floater if the leading digits are followed by a fraction or exponent
+        while (_private::isDigit(*pos)) ++pos;
+        return (*pos == '.' && _private::isDigit(pos[1])) || *pos == 'e' || *pos == 'E' ? DecodeState::floater : DecodeState::integer;
+    }
+
+    template <typename T>
+    inline bool Decoder::tryRead(T && v)
+    {
+        // Everything that decoding a single value may change
+        const DecodeState state{_state};
+        const char * const pos{_pos};
+        const u64 stack{_stack};
+        const u64 depth{_depth};
+        const bool hadComma{_hadComma};
+
+        *this >> v;
+
+        if (_state == DecodeState::error)
+        {
+            // Do not mask an error that was already there
+            if (state != DecodeState::error)
+            {
+                _state = state;
+                _pos = pos;
+                _stack = stack;
+                _depth = depth;
+                _hadComma = hadComma;
+            }
+
+            return false;
+        }
+
+        return true;
+    }
+
     inline void Decoder::_reset()
     {
         _state = DecodeState::error;
@@ -833,13 +2158,49 @@ namespace qcon
         _pos = nullptr;
         _stack = 0u;
         _depth = 0u;
-        _cachedEnd = nullptr;
+        _stackSpill.clear();
+        _end = nullptr;
         _hadComma = false;
+        _file.unmap();
+        _discarded = 0u;
+        _error = ErrorCode::none;
+        _errorOffset = 0u;
+        _errorValue = 0u;
+        _errorText = {};
+    }
+
+    inline void Decoder::_setError(const ErrorCode error, const u64 value)
+    {
+        _error = error;
+        _errorOffset = _discarded + u64(_pos - _qcon);
+        _errorValue = value;
+    }
+
+    inline void Decoder::_rebaseViews(const Decoder & other)
+    {
+        // Views of `other`'s owned strings must follow their contents, which may have been copied rather than moved
+        if (keyView.data() == other.key.data())
+        {
+            keyView = key;
+        }
+        if (stringView.data() == other.string.data())
+        {
+            stringView = string;
+        }
     }
 
     inline void Decoder::_skipSpace()
     {
-        while (_isSpace(*_pos)) ++_pos;
+        // Most gaps are a few characters at most, so only scan in blocks for longer runs like deep indentation
+        const char * const start{_pos};
+        while (_isSpace(*_pos))
+        {
+            if (++_pos - start >= 8)
+            {
+                _pos = _findNonSpace(_pos);
+                return;
+            }
+        }
     }
 
     inline void Decoder::_skipSpaceAndComments()
@@ -849,11 +2210,8 @@ namespace qcon
         // Skip comments and space
         while (*_pos == '#')
         {
-            // Skip `#`
-            ++_pos;
-
-            // Skip rest of line
-            while (*_pos && *_pos != '\n') ++_pos;
+            // Skip `#` and the rest of the line
+            _pos = _findLineEnd(_pos + 1);
 
             _skipSpace();
         }
@@ -875,7 +2233,7 @@ namespace qcon
                 // Ensure we have key if in object
                 if (_state != DecodeState::key)
                 {
-                    errorMessage = "Expected key"sv;
+                    _setError(ErrorCode::expectedKey);
                     _state = DecodeState::error;
                     return false;
                 }
@@ -885,7 +2243,7 @@ namespace qcon
                 // Ensure there is a comma between array elements
                 if (_state != DecodeState::array && !_hadComma)
                 {
-                    errorMessage = "Expected comma"sv;
+                    _setError(ErrorCode::expectedComma);
                     _state = DecodeState::error;
                     return false;
                 }
@@ -896,7 +2254,7 @@ namespace qcon
             // Ensure only one value at root level
             if (_state != DecodeState::ready)
             {
-                errorMessage = "Root may only have a single value"sv;
+                _setError(ErrorCode::multipleRootValues);
                 _state = DecodeState::error;
                 return false;
             }
@@ -918,7 +2276,7 @@ namespace qcon
         // Ensure there is a comma between elements
         if (_state != DecodeState::object && !_hadComma)
         {
-            errorMessage = "Expected comma"sv;
+            _setError(ErrorCode::expectedComma);
             _state = DecodeState::error;
             return false;
         }
@@ -943,10 +2301,10 @@ namespace qcon
         }
         else
         {
-            // Ensure there is nothing else at root level
-            if (*_pos)
+            // Ensure there is nothing else at root level, unless it is the next document
+            if ((*_pos && !documentStream) || (!*_pos && _end && _pos != _end))
             {
-                errorMessage = "Extraneous root content"sv;
+                _setError(ErrorCode::extraneousRootContent);
                 _state = DecodeState::error;
             }
         }
@@ -1108,6 +2466,51 @@ namespace qcon
         return true;
     }
 
+    // Consumes up to eight decimal digits at once, returning how many were consumed
+    // `dst` must be small enough to not overflow when multiplied by 10^8
+    QCON_NOINLINE inline u64 Decoder::_consumeDecimalDigitBlock(u64 & dst)
+    {
+        static constexpr u64 ones{0x0101010101010101u};
+        static constexpr u64 powersOf10[9u]{1u, 10u, 100u, 1'000u, 10'000u, 100'000u, 1'000'000u, 10'000'000u, 100'000'000u};
+
+        // Bytes are interpreted in reading order, and the block may extend past the end
+        if constexpr (std::endian::native != std::endian::little || !_blockReads)
+        {
+            return 0u;
+        }
+
+        // Don't read into the next page, which may not exist
+        if ((reinterpret_cast<std::uintptr_t>(_pos) & 4095u) > 4096u - 8u)
+        {
+            return 0u;
+        }
+
+        u64 block;
+        std::memcpy(&block, _pos, 8u);
+
+        // Flag bytes that are not digits; `0` through `9` map to 0 through 9, and anything else to at least 10
+        const u64 x{block ^ (ones * '0')};
+        const u64 nonDigits{(((x & (ones * 0x7Fu)) + (ones * (0x80u - 10u))) | x) & (ones * 0x80u)};
+        const u64 digits{u64(std::countr_zero(nonDigits)) / 8u};
+        if (!digits)
+        {
+            return 0u;
+        }
+
+        // Shift the digits to the top so the non-digits fall off and are replaced with leading zeroes
+        // Borrows from non-digits propagate towards later bytes, so they do not affect the digits
+        u64 v{(block - ones * '0') << (8u * (8u - digits))};
+
+        // Combine pairs of digits, then pairs of pairs, then pairs of quads
+        v = (v * 10u + (v >> 8)) & 0x00FF00FF00FF00FFu;
+        v = (v * 100u + (v >> 16)) & 0x0000FFFF0000FFFFu;
+        v = (v * 10'000u + (v >> 32)) & 0x00000000FFFFFFFFu;
+
+        dst = dst * powersOf10[digits] + v;
+        _pos += digits;
+        return digits;
+    }
+
     // Assumed to not overflow
     inline bool Decoder::_tryConsumeDecimalDigits(u64 digits, u64 & dst)
     {
@@ -1150,8 +2553,7 @@ namespace qcon
     {
         if (!_tryConsumeChar(c))
         {
-            errorMessage.clear();
-            std::format_to(std::back_inserter(errorMessage), "Expected `{}`"sv, c);
+            _setError(ErrorCode::expectedCharacter, u8(c));
             return false;
         }
 
@@ -1162,8 +2564,8 @@ namespace qcon
     {
         if (!_tryConsumeChars(str))
         {
-            errorMessage.clear();
-            std::format_to(std::back_inserter(errorMessage), "Expected `{}`"sv, str);
+            _setError(ErrorCode::expectedCharacters);
+            _errorText = str;
             return false;
         }
 
@@ -1178,8 +2580,7 @@ namespace qcon
         }
         else
         {
-            errorMessage.clear();
-            std::format_to(std::back_inserter(errorMessage), "Expected {} decimal digits"sv, digits);
+            _setError(ErrorCode::expectedDecimalDigits, digits);
             return false;
         }
     }
@@ -1192,8 +2593,7 @@ namespace qcon
         }
         else
         {
-            errorMessage.clear();
-            std::format_to(std::back_inserter(errorMessage), "Expected {} hex digits"sv, digits);
+            _setError(ErrorCode::expectedHexDigits, digits);
             return false;
         }
     }
@@ -1215,7 +2615,7 @@ namespace qcon
         //               AAAAAAA -> 0AAAAAAA
         if (codepoint >= (1u << 21))
         {
-            errorMessage = "Codepoint too large"sv;
+            _setError(ErrorCode::codepointTooLarge);
             return false;
         }
         else if (codepoint >= (1u << 16))
@@ -1268,7 +2668,7 @@ namespace qcon
             default:
             {
                 --_pos;
-                errorMessage = "Invalid escape sequence"sv;
+                _setError(ErrorCode::invalidEscapeSequence);
                 return false;
             }
         }
@@ -1277,27 +2677,68 @@ namespace qcon
         return true;
     }
 
-    inline bool Decoder::_consumeString(std::string & dst)
+    inline bool Decoder::_consumeString(std::string & dst, std::string_view & view)
     {
         // We already know we have `"`
 
-        dst.clear();
+        if (zeroCopy)
+        {
+            // If the string has no escapes and is not concatenated, it can be viewed directly
+            const char * const start{_pos};
+            const char * const end{_findStringSpecial(_pos)};
+            _pos = end;
+
+            if (*_pos == '"')
+            {
+                ++_pos;
+
+                _skipSpaceAndComments();
+
+                if (*_pos != '"' || (documentStream && !_depth))
+                {
+                    view = std::string_view{start, end};
+                    return true;
+                }
+
+                ++_pos;
+            }
+
+            // Otherwise fall back to building the string from what we have so far
+            dst.assign(start, end);
+        }
+        else
+        {
+            dst.clear();
+        }
 
         while (true)
         {
-            char c{*_pos};
+            // Append the run of plain characters all at once, unless it is short enough that the call isn't worth it
+            const char * const runEnd{_findStringSpecial(_pos)};
+            if (runEnd - _pos > 16)
+            {
+                dst.append(_pos, runEnd);
+                _pos = runEnd;
+            }
+            else
+            {
+                for (; _pos < runEnd; ++_pos) dst.push_back(*_pos);
+            }
+
+            const char c{*_pos};
             if (c == '"')
             {
                 ++_pos;
 
                 _skipSpaceAndComments();
 
-                if (*_pos == '"')
+                if (*_pos == '"' && (!documentStream || _depth))
                 {
                     ++_pos;
                 }
                 else
                 {
+                    view = dst;
                     return true;
                 }
             }
@@ -1310,27 +2751,22 @@ namespace qcon
                     return false;
                 }
             }
-            else if (_private::isControl(c))
-            {
-                errorMessage = "Invalid string content"sv;
-                return false;
-            }
             else
             {
-                dst.push_back(c);
-                ++_pos;
+                _setError(ErrorCode::invalidStringContent);
+                return false;
             }
         }
     }
 
-    inline bool Decoder::_consumeKey(std::string & dst)
+    inline bool Decoder::_consumeKey(std::string & dst, std::string_view & view)
     {
         if (!_consumeChar('"'))
         {
             return false;
         }
 
-        if (!_consumeString(dst))
+        if (!_consumeString(dst, view))
         {
             return false;
         }
@@ -1355,7 +2791,7 @@ namespace qcon
 
         if (_pos == start)
         {
-            errorMessage = "Missing binary digit"sv;
+            _setError(ErrorCode::missingBinaryDigit);
             return false;
         }
 
@@ -1372,7 +2808,7 @@ namespace qcon
 
         if (_pos == start)
         {
-            errorMessage = "Missing octal digit"sv;
+            _setError(ErrorCode::missingOctalDigit);
             return false;
         }
 
@@ -1385,11 +2821,20 @@ namespace qcon
 
         dst = 0u;
 
+        // Consume eight digits at a time while there is no risk of overflow, unless there is only a single digit, which
+        //   is both common and faster to consume individually
+        // The first digit is checked first so as to not read past the end
+        if (_private::isDigit(_pos[0]) && _private::isDigit(_pos[1]))
+        {
+            while (dst < 100'000'000'000u && _consumeDecimalDigitBlock(dst) == 8u);
+        }
+
+        // Consume the rest one at a time, stopping before overflow
         while (_tryConsumeDecimalDigit<true>(dst));
 
         if (_pos == start)
         {
-            errorMessage = "Missing decimal digit"sv;
+            _setError(ErrorCode::missingDecimalDigit);
             return false;
         }
 
@@ -1406,107 +2851,953 @@ namespace qcon
 
         if (_pos == start)
         {
-            errorMessage = "Missing hex digit"sv;
+            _setError(ErrorCode::missingHexDigit);
             return false;
         }
 
         return true;
     }
 
-    inline bool Decoder::_consumeInteger(s64 & dst)
+    inline DecodeState Decoder::_consumeNumber(s64 & integerDst, f64 & floaterDst)
     {
         // Already know we have digit
 
         u64 v;
 
         // Check if hex/octal/binary
-        if (*_pos == '0')
+        if (*_pos == '0' && (_pos[1] == 'b' || _pos[1] == 'o' || _pos[1] == 'x'))
         {
             ++_pos;
 
-            switch (*_pos)
+            switch (*_pos++)
             {
                 case 'b':
                 {
-                    ++_pos;
                     if (!_consumeBinaryInteger(v))
                     {
-                        return false;
+                        return DecodeState::error;
                     }
                     break;
                 }
                 case 'o':
                 {
-                    ++_pos;
                     if (!_consumeOctalInteger(v))
                     {
-                        return false;
-                    }
-                    break;
-                }
-                case 'x':
-                {
-                    ++_pos;
-                    if (!_consumeHexInteger(v))
-                    {
-                        return false;
+                        return DecodeState::error;
                     }
                     break;
                 }
                 default:
                 {
-                    --_pos;
-                    if (!_consumeDecimalInteger(v))
+                    if (!_consumeHexInteger(v))
                     {
-                        return false;
+                        return DecodeState::error;
                     }
                 }
             }
         }
-        else if (!_consumeDecimalInteger(v))
+        else
         {
-            return false;
+            // Accumulate digits as an integer until it's clear whether the number is actually a floater
+            const char * const start{_pos};
+            v = 0u;
+
+            // Short digit runs, such as most integer parts of floaters, are fastest consumed one at a time
+            while (_private::isDigit(*_pos) && _pos - start < 8)
+            {
+                v = v * 10u + u64(*_pos - '0');
+                ++_pos;
+            }
+
+            // Long digit runs, such as IDs, continue eight at a time while there is no risk of overflow
+            if (_private::isDigit(*_pos))
+            {
+                while (v < 100'000'000'000u && _consumeDecimalDigitBlock(v) == 8u);
+            }
+
+            // Consume the rest one at a time, ignoring overflow until it's known to matter
+            const char * end{_pos};
+            while (_private::isDigit(*end))
+            {
+                v = v * 10u + u64(*end - '0');
+                ++end;
+            }
+
+            if ((*end == '.' && _private::isDigit(end[1])) || *end == 'e' || *end == 'E')
+            {
+                _pos = end;
+                return _consumeFloater(floaterDst, start, v) ? DecodeState::floater : DecodeState::error;
+            }
+
+            // Integers of up to 19 digits cannot overflow, otherwise start over to stop exactly at overflow
+            if (end - start <= 19)
+            {
+                _pos = end;
+            }
+            else
+            {
+                _pos = start;
+                if (!_consumeDecimalInteger(v))
+                {
+                    return DecodeState::error;
+                }
+            }
         }
 
         if (positive)
         {
-            dst = s64(v);
+            integerDst = s64(v);
         }
         else
         {
             // The integer is too large to fit in an `s64` when negative
             if (v > u64(std::numeric_limits<s64>::min()))
             {
-                errorMessage = "Negative integer too large"sv;
-                return false;
+                _setError(ErrorCode::negativeIntegerTooLarge);
+                return DecodeState::error;
             }
 
-            dst = -s64(v);
+            integerDst = -s64(v);
         }
 
-        return true;
+        return DecodeState::integer;
     }
 
-    inline bool Decoder::_consumeFloater(f64 & dst)
-    {
-        // Determine end of QCON
-        if (!_cachedEnd) [[unlikely]]
-        {
-            _cachedEnd = _pos;
-            while (*_cachedEnd) ++_cachedEnd;
+    inline constexpr s64 _minPowerOf10{-342}; /// Smallest power of ten for which a nonzero double may be produced
+    inline constexpr s64 _maxPowerOf10{308};  /// Largest power of ten for which a finite double may be produced
+
+    ///
+    /// 128 bit approximations of the powers of five in range [5^-342, 5^308], as high then low halves
+    /// Each is shifted so its most significant bit is set; positive powers are truncated and negative powers rounded up
+    ///
+    inline constexpr u64 _powersOf5[2u * u64(_maxPowerOf10 - _minPowerOf10 + 1)]{
+        0xEEF453D6923BD65Au, 0x113FAA2906A13B3Fu, // 5^-342
+        0x9558B4661B6565F8u, 0x4AC7CA59A424C507u, // 5^-341
+        0xBAAEE17FA23EBF76u, 0x5D79BCF00D2DF649u, // 5^-340
+        0xE95A99DF8ACE6F53u, 0xF4D82C2C107973DCu, // 5^-339
+        0x91D8A02BB6C10594u, 0x79071B9B8A4BE869u, // 5^-338
+        0xB64EC836A47146F9u, 0x9748E2826CDEE284u, // 5^-337
+        0xE3E27A444D8D98B7u, 0xFD1B1B2308169B25u, // 5^-336
+        0x8E6D8C6AB0787F72u, 0xFE30F0F5E50E20F7u, // 5^-335
+        0xB208EF855C969F4Fu, 0xBDBD2D335E51A935u, // 5^-334
+        0xDE8B2B66B3BC4723u, 0xAD2C788035E61382u, // 5^-333
+        0x8B16FB203055AC76u, 0x4C3BCB5021AFCC31u, // 5^-332
+        0xADDCB9E83C6B1793u, 0xDF4ABE242A1BBF3Du, // 5^-331
+        0xD953E8624B85DD78u, 0xD71D6DAD34A2AF0Du, // 5^-330
+        0x87D4713D6F33AA6Bu, 0x8672648C40E5AD68u, // 5^-329
+        0xA9C98D8CCB009506u, 0x680EFDAF511F18C2u, // 5^-328
+        0xD43BF0EFFDC0BA48u, 0x0212BD1B2566DEF2u, // 5^-327
+        0x84A57695FE98746Du, 0x014BB630F7604B57u, // 5^-326
+        0xA5CED43B7E3E9188u, 0x419EA3BD35385E2Du, // 5^-325
+        0xCF42894A5DCE35EAu, 0x52064CAC828675B9u, // 5^-324
+        0x818995CE7AA0E1B2u, 0x7343EFEBD1940993u, // 5^-323
+        0xA1EBFB4219491A1Fu, 0x1014EBE6C5F90BF8u, // 5^-322
+        0xCA66FA129F9B60A6u, 0xD41A26E077774EF6u, // 5^-321
+        0xFD00B897478238D0u, 0x8920B098955522B4u, // 5^-320
+        0x9E20735E8CB16382u, 0x55B46E5F5D5535B0u, // 5^-319
+        0xC5A890362FDDBC62u, 0xEB2189F734AA831Du, // 5^-318
+        0xF712B443BBD52B7Bu, 0xA5E9EC7501D523E4u, // 5^-317
+        0x9A6BB0AA55653B2Du, 0x47B233C92125366Eu, // 5^-316
+        0xC1069CD4EABE89F8u, 0x999EC0BB696E840Au, // 5^-315
+        0xF148440A256E2C76u, 0xC00670EA43CA250Du, // 5^-314
+        0x96CD2A865764DBCAu, 0x380406926A5E5728u, // 5^-313
+        0xBC807527ED3E12BCu, 0xC605083704F5ECF2u, // 5^-312
+        0xEBA09271E88D976Bu, 0xF7864A44C633682Eu, // 5^-311
+        0x93445B8731587EA3u, 0x7AB3EE6AFBE0211Du, // 5^-310
+        0xB8157268FDAE9E4Cu, 0x5960EA05BAD82964u, // 5^-309
+        0xE61ACF033D1A45DFu, 0x6FB92487298E33BDu, // 5^-308
+        0x8FD0C16206306BABu, 0xA5D3B6D479F8E056u, // 5^-307
+        0xB3C4F1BA87BC8696u, 0x8F48A4899877186Cu, // 5^-306
+        0xE0B62E2929ABA83Cu, 0x331ACDABFE94DE87u, // 5^-305
+        0x8C71DCD9BA0B4925u, 0x9FF0C08B7F1D0B14u, // 5^-304
+        0xAF8E5410288E1B6Fu, 0x07ECF0AE5EE44DD9u, // 5^-303
+        0xDB71E91432B1A24Au, 0xC9E82CD9F69D6150u, // 5^-302
+        0x892731AC9FAF056Eu, 0xBE311C083A225CD2u, // 5^-301
+        0xAB70FE17C79AC6CAu, 0x6DBD630A48AAF406u, // 5^-300
+        0xD64D3D9DB981787Du, 0x092CBBCCDAD5B108u, // 5^-299
+        0x85F0468293F0EB4Eu, 0x25BBF56008C58EA5u, // 5^-298
+        0xA76C582338ED2621u, 0xAF2AF2B80AF6F24Eu, // 5^-297
+        0xD1476E2C07286FAAu, 0x1AF5AF660DB4AEE1u, // 5^-296
+        0x82CCA4DB847945CAu, 0x50D98D9FC890ED4Du, // 5^-295
+        0xA37FCE126597973Cu, 0xE50FF107BAB528A0u, // 5^-294
+        0xCC5FC196FEFD7D0Cu, 0x1E53ED49A96272C8u, // 5^-293
+        0xFF77B1FCBEBCDC4Fu, 0x25E8E89C13BB0F7Au, // 5^-292
+        0x9FAACF3DF73609B1u, 0x77B191618C54E9ACu, // 5^-291
+        0xC795830D75038C1Du, 0xD59DF5B9EF6A2417u, // 5^-290
+        0xF97AE3D0D2446F25u, 0x4B0573286B44AD1Du, // 5^-289
+        0x9BECCE62836AC577u, 0x4EE367F9430AEC32u, // 5^-288
+        0xC2E801FB244576D5u, 0x229C41F793CDA73Fu, // 5^-287
+        0xF3A20279ED56D48Au, 0x6B43527578C1110Fu, // 5^-286
+        0x9845418C345644D6u, 0x830A13896B78AAA9u, // 5^-285
+        0xBE5691EF416BD60Cu, 0x23CC986BC656D553u, // 5^-284
+        0xEDEC366B11C6CB8Fu, 0x2CBFBE86B7EC8AA8u, // 5^-283
+        0x94B3A202EB1C3F39u, 0x7BF7D71432F3D6A9u, // 5^-282
+        0xB9E08A83A5E34F07u, 0xDAF5CCD93FB0CC53u, // 5^-281
+        0xE858AD248F5C22C9u, 0xD1B3400F8F9CFF68u, // 5^-280
+        0x91376C36D99995BEu, 0x23100809B9C21FA1u, // 5^-279
+        0xB58547448FFFFB2Du, 0xABD40A0C2832A78Au, // 5^-278
+        0xE2E69915B3FFF9F9u, 0x16C90C8F323F516Cu, // 5^-277
+        0x8DD01FAD907FFC3Bu, 0xAE3DA7D97F6792E3u, // 5^-276
+        0xB1442798F49FFB4Au, 0x99CD11CFDF41779Cu, // 5^-275
+        0xDD95317F31C7FA1Du, 0x40405643D711D583u, // 5^-274
+        0x8A7D3EEF7F1CFC52u, 0x482835EA666B2572u, // 5^-273
+        0xAD1C8EAB5EE43B66u, 0xDA3243650005EECFu, // 5^-272
+        0xD863B256369D4A40u, 0x90BED43E40076A82u, // 5^-271
+        0x873E4F75E2224E68u, 0x5A7744A6E804A291u, // 5^-270
+        0xA90DE3535AAAE202u, 0x711515D0A205CB36u, // 5^-269
+        0xD3515C2831559A83u, 0x0D5A5B44CA873E03u, // 5^-268
+        0x8412D9991ED58091u, 0xE858790AFE9486C2u, // 5^-267
+        0xA5178FFF668AE0B6u, 0x626E974DBE39A872u, // 5^-266
+        0xCE5D73FF402D98E3u, 0xFB0A3D212DC8128Fu, // 5^-265
+        0x80FA687F881C7F8Eu, 0x7CE66634BC9D0B99u, // 5^-264
+        0xA139029F6A239F72u, 0x1C1FFFC1EBC44E80u, // 5^-263
+        0xC987434744AC874Eu, 0xA327FFB266B56220u, // 5^-262
+        0xFBE9141915D7A922u, 0x4BF1FF9F0062BAA8u, // 5^-261
+        0x9D71AC8FADA6C9B5u, 0x6F773FC3603DB4A9u, // 5^-260
+        0xC4CE17B399107C22u, 0xCB550FB4384D21D3u, // 5^-259
+        0xF6019DA07F549B2Bu, 0x7E2A53A146606A48u, // 5^-258
+        0x99C102844F94E0FBu, 0x2EDA7444CBFC426Du, // 5^-257
+        0xC0314325637A1939u, 0xFA911155FEFB5308u, // 5^-256
+        0xF03D93EEBC589F88u, 0x793555AB7EBA27CAu, // 5^-255
+        0x96267C7535B763B5u, 0x4BC1558B2F3458DEu, // 5^-254
+        0xBBB01B9283253CA2u, 0x9EB1AAEDFB016F16u, // 5^-253
+        0xEA9C227723EE8BCBu, 0x465E15A979C1CADCu, // 5^-252
+        0x92A1958A7675175Fu, 0x0BFACD89EC191EC9u, // 5^-251
+        0xB749FAED14125D36u, 0xCEF980EC671F667Bu, // 5^-250
+        0xE51C79A85916F484u, 0x82B7E12780E7401Au, // 5^-249
+        0x8F31CC0937AE58D2u, 0xD1B2ECB8B0908810u, // 5^-248
+        0xB2FE3F0B8599EF07u, 0x861FA7E6DCB4AA15u, // 5^-247
+        0xDFBDCECE67006AC9u, 0x67A791E093E1D49Au, // 5^-246
+        0x8BD6A141006042BDu, 0xE0C8BB2C5C6D24E0u, // 5^-245
+        0xAECC49914078536Du, 0x58FAE9F773886E18u, // 5^-244
+        0xDA7F5BF590966848u, 0xAF39A475506A899Eu, // 5^-243
+        0x888F99797A5E012Du, 0x6D8406C952429603u, // 5^-242
+        0xAAB37FD7D8F58178u, 0xC8E5087BA6D33B83u, // 5^-241
+        0xD5605FCDCF32E1D6u, 0xFB1E4A9A90880A64u, // 5^-240
+        0x855C3BE0A17FCD26u, 0x5CF2EEA09A55067Fu, // 5^-239
+        0xA6B34AD8C9DFC06Fu, 0xF42FAA48C0EA481Eu, // 5^-238
+        0xD0601D8EFC57B08Bu, 0xF13B94DAF124DA26u, // 5^-237
+        0x823C12795DB6CE57u, 0x76C53D08D6B70858u, // 5^-236
+        0xA2CB1717B52481EDu, 0x54768C4B0C64CA6Eu, // 5^-235
+        0xCB7DDCDDA26DA268u, 0xA9942F5DCF7DFD09u, // 5^-234
+        0xFE5D54150B090B02u, 0xD3F93B35435D7C4Cu, // 5^-233
+        0x9EFA548D26E5A6E1u, 0xC47BC5014A1A6DAFu, // 5^-232
+        0xC6B8E9B0709F109Au, 0x359AB6419CA1091Bu, // 5^-231
+        0xF867241C8CC6D4C0u, 0xC30163D203C94B62u, // 5^-230
+        0x9B407691D7FC44F8u, 0x79E0DE63425DCF1Du, // 5^-229
+        0xC21094364DFB5636u, 0x985915FC12F542E4u, // 5^-228
+        0xF294B943E17A2BC4u, 0x3E6F5B7B17B2939Du, // 5^-227
+        0x979CF3CA6CEC5B5Au, 0xA705992CEECF9C42u, // 5^-226
+        0xBD8430BD08277231u, 0x50C6FF782A838353u, // 5^-225
+        0xECE53CEC4A314EBDu, 0xA4F8BF5635246428u, // 5^-224
+        0x940F4613AE5ED136u, 0x871B7795E136BE99u, // 5^-223
+        0xB913179899F68584u, 0x28E2557B59846E3Fu, // 5^-222
+        0xE757DD7EC07426E5u, 0x331AEADA2FE589CFu, // 5^-221
+        0x9096EA6F3848984Fu, 0x3FF0D2C85DEF7621u, // 5^-220
+        0xB4BCA50B065ABE63u, 0x0FED077A756B53A9u, // 5^-219
+        0xE1EBCE4DC7F16DFBu, 0xD3E8495912C62894u, // 5^-218
+        0x8D3360F09CF6E4BDu, 0x64712DD7ABBBD95Cu, // 5^-217
+        0xB080392CC4349DECu, 0xBD8D794D96AACFB3u, // 5^-216
+        0xDCA04777F541C567u, 0xECF0D7A0FC5583A0u, // 5^-215
+        0x89E42CAAF9491B60u, 0xF41686C49DB57244u, // 5^-214
+        0xAC5D37D5B79B6239u, 0x311C2875C522CED5u, // 5^-213
+        0xD77485CB25823AC7u, 0x7D633293366B828Bu, // 5^-212
+        0x86A8D39EF77164BCu, 0xAE5DFF9C02033197u, // 5^-211
+        0xA8530886B54DBDEBu, 0xD9F57F830283FDFCu, // 5^-210
+        0xD267CAA862A12D66u, 0xD072DF63C324FD7Bu, // 5^-209
+        0x8380DEA93DA4BC60u, 0x4247CB9E59F71E6Du, // 5^-208
+        0xA46116538D0DEB78u, 0x52D9BE85F074E608u, // 5^-207
+        0xCD795BE870516656u, 0x67902E276C921F8Bu, // 5^-206
+        0x806BD9714632DFF6u, 0x00BA1CD8A3DB53B6u, // 5^-205
+        0xA086CFCD97BF97F3u, 0x80E8A40ECCD228A4u, // 5^-204
+        0xC8A883C0FDAF7DF0u, 0x6122CD128006B2CDu, // 5^-203
+        0xFAD2A4B13D1B5D6Cu, 0x796B805720085F81u, // 5^-202
+        0x9CC3A6EEC6311A63u, 0xCBE3303674053BB0u, // 5^-201
+        0xC3F490AA77BD60FCu, 0xBEDBFC4411068A9Cu, // 5^-200
+        0xF4F1B4D515ACB93Bu, 0xEE92FB5515482D44u, // 5^-199
+        0x991711052D8BF3C5u, 0x751BDD152D4D1C4Au, // 5^-198
+        0xBF5CD54678EEF0B6u, 0xD262D45A78A0635Du, // 5^-197
+        0xEF340A98172AACE4u, 0x86FB897116C87C34u, // 5^-196
+        0x9580869F0E7AAC0Eu, 0xD45D35E6AE3D4DA0u, // 5^-195
+        0xBAE0A846D2195712u, 0x8974836059CCA109u, // 5^-194
+        0xE998D258869FACD7u, 0x2BD1A438703FC94Bu, // 5^-193
+        0x91FF83775423CC06u, 0x7B6306A34627DDCFu, // 5^-192
+        0xB67F6455292CBF08u, 0x1A3BC84C17B1D542u, // 5^-191
+        0xE41F3D6A7377EECAu, 0x20CABA5F1D9E4A93u, // 5^-190
+        0x8E938662882AF53Eu, 0x547EB47B7282EE9Cu, // 5^-189
+        0xB23867FB2A35B28Du, 0xE99E619A4F23AA43u, // 5^-188
+        0xDEC681F9F4C31F31u, 0x6405FA00E2EC94D4u, // 5^-187
+        0x8B3C113C38F9F37Eu, 0xDE83BC408DD3DD04u, // 5^-186
+        0xAE0B158B4738705Eu, 0x9624AB50B148D445u, // 5^-185
+        0xD98DDAEE19068C76u, 0x3BADD624DD9B0957u, // 5^-184
+        0x87F8A8D4CFA417C9u, 0xE54CA5D70A80E5D6u, // 5^-183
+        0xA9F6D30A038D1DBCu, 0x5E9FCF4CCD211F4Cu, // 5^-182
+        0xD47487CC8470652Bu, 0x7647C3200069671Fu, // 5^-181
+        0x84C8D4DFD2C63F3Bu, 0x29ECD9F40041E073u, // 5^-180
+        0xA5FB0A17C777CF09u, 0xF468107100525890u, // 5^-179
+        0xCF79CC9DB955C2CCu, 0x7182148D4066EEB4u, // 5^-178
+        0x81AC1FE293D599BFu, 0xC6F14CD848405530u, // 5^-177
+        0xA21727DB38CB002Fu, 0xB8ADA00E5A506A7Cu, // 5^-176
+        0xCA9CF1D206FDC03Bu, 0xA6D90811F0E4851Cu, // 5^-175
+        0xFD442E4688BD304Au, 0x908F4A166D1DA663u, // 5^-174
+        0x9E4A9CEC15763E2Eu, 0x9A598E4E043287FEu, // 5^-173
+        0xC5DD44271AD3CDBAu, 0x40EFF1E1853F29FDu, // 5^-172
+        0xF7549530E188C128u, 0xD12BEE59E68EF47Cu, // 5^-171
+        0x9A94DD3E8CF578B9u, 0x82BB74F8301958CEu, // 5^-170
+        0xC13A148E3032D6E7u, 0xE36A52363C1FAF01u, // 5^-169
+        0xF18899B1BC3F8CA1u, 0xDC44E6C3CB279AC1u, // 5^-168
+        0x96F5600F15A7B7E5u, 0x29AB103A5EF8C0B9u, // 5^-167
+        0xBCB2B812DB11A5DEu, 0x7415D448F6B6F0E7u, // 5^-166
+        0xEBDF661791D60F56u, 0x111B495B3464AD21u, // 5^-165
+        0x936B9FCEBB25C995u, 0xCAB10DD900BEEC34u, // 5^-164
+        0xB84687C269EF3BFBu, 0x3D5D514F40EEA742u, // 5^-163
+        0xE65829B3046B0AFAu, 0x0CB4A5A3112A5112u, // 5^-162
+        0x8FF71A0FE2C2E6DCu, 0x47F0E785EABA72ABu, // 5^-161
+        0xB3F4E093DB73A093u, 0x59ED216765690F56u, // 5^-160
+        0xE0F218B8D25088B8u, 0x306869C13EC3532Cu, // 5^-159
+        0x8C974F7383725573u, 0x1E414218C73A13FBu, // 5^-158
+        0xAFBD2350644EEACFu, 0xE5D1929EF90898FAu, // 5^-157
+        0xDBAC6C247D62A583u, 0xDF45F746B74ABF39u, // 5^-156
+        0x894BC396CE5DA772u, 0x6B8BBA8C328EB783u, // 5^-155
+        0xAB9EB47C81F5114Fu, 0x066EA92F3F326564u, // 5^-154
+        0xD686619BA27255A2u, 0xC80A537B0EFEFEBDu, // 5^-153
+        0x8613FD0145877585u, 0xBD06742CE95F5F36u, // 5^-152
+        0xA798FC4196E952E7u, 0x2C48113823B73704u, // 5^-151
+        0xD17F3B51FCA3A7A0u, 0xF75A15862CA504C5u, // 5^-150
+        0x82EF85133DE648C4u, 0x9A984D73DBE722FBu, // 5^-149
+        0xA3AB66580D5FDAF5u, 0xC13E60D0D2E0EBBAu, // 5^-148
+        0xCC963FEE10B7D1B3u, 0x318DF905079926A8u, // 5^-147
+        0xFFBBCFE994E5C61Fu, 0xFDF17746497F7052u, // 5^-146
+        0x9FD561F1FD0F9BD3u, 0xFEB6EA8BEDEFA633u, // 5^-145
+        0xC7CABA6E7C5382C8u, 0xFE64A52EE96B8FC0u, // 5^-144
+        0xF9BD690A1B68637Bu, 0x3DFDCE7AA3C673B0u, // 5^-143
+        0x9C1661A651213E2Du, 0x06BEA10CA65C084Eu, // 5^-142
+        0xC31BFA0FE5698DB8u, 0x486E494FCFF30A62u, // 5^-141
+        0xF3E2F893DEC3F126u, 0x5A89DBA3C3EFCCFAu, // 5^-140
+        0x986DDB5C6B3A76B7u, 0xF89629465A75E01Cu, // 5^-139
+        0xBE89523386091465u, 0xF6BBB397F1135823u, // 5^-138
+        0xEE2BA6C0678B597Fu, 0x746AA07DED582E2Cu, // 5^-137
+        0x94DB483840B717EFu, 0xA8C2A44EB4571CDCu, // 5^-136
+        0xBA121A4650E4DDEBu, 0x92F34D62616CE413u, // 5^-135
+        0xE896A0D7E51E1566u, 0x77B020BAF9C81D17u, // 5^-134
+        0x915E2486EF32CD60u, 0x0ACE1474DC1D122Eu, // 5^-133
+        0xB5B5ADA8AAFF80B8u, 0x0D819992132456BAu, // 5^-132
+        0xE3231912D5BF60E6u, 0x10E1FFF697ED6C69u, // 5^-131
+        0x8DF5EFABC5979C8Fu, 0xCA8D3FFA1EF463C1u, // 5^-130
+        0xB1736B96B6FD83B3u, 0xBD308FF8A6B17CB2u, // 5^-129
+        0xDDD0467C64BCE4A0u, 0xAC7CB3F6D05DDBDEu, // 5^-128
+        0x8AA22C0DBEF60EE4u, 0x6BCDF07A423AA96Bu, // 5^-127
+        0xAD4AB7112EB3929Du, 0x86C16C98D2C953C6u, // 5^-126
+        0xD89D64D57A607744u, 0xE871C7BF077BA8B7u, // 5^-125
+        0x87625F056C7C4A8Bu, 0x11471CD764AD4972u, // 5^-124
+        0xA93AF6C6C79B5D2Du, 0xD598E40D3DD89BCFu, // 5^-123
+        0xD389B47879823479u, 0x4AFF1D108D4EC2C3u, // 5^-122
+        0x843610CB4BF160CBu, 0xCEDF722A585139BAu, // 5^-121
+        0xA54394FE1EEDB8FEu, 0xC2974EB4EE658828u, // 5^-120
+        0xCE947A3DA6A9273Eu, 0x733D226229FEEA32u, // 5^-119
+        0x811CCC668829B887u, 0x0806357D5A3F525Fu, // 5^-118
+        0xA163FF802A3426A8u, 0xCA07C2DCB0CF26F7u, // 5^-117
+        0xC9BCFF6034C13052u, 0xFC89B393DD02F0B5u, // 5^-116
+        0xFC2C3F3841F17C67u, 0xBBAC2078D443ACE2u, // 5^-115
+        0x9D9BA7832936EDC0u, 0xD54B944B84AA4C0Du, // 5^-114
+        0xC5029163F384A931u, 0x0A9E795E65D4DF11u, // 5^-113
+        0xF64335BCF065D37Du, 0x4D4617B5FF4A16D5u, // 5^-112
+        0x99EA0196163FA42Eu, 0x504BCED1BF8E4E45u, // 5^-111
+        0xC06481FB9BCF8D39u, 0xE45EC2862F71E1D6u, // 5^-110
+        0xF07DA27A82C37088u, 0x5D767327BB4E5A4Cu, // 5^-109
+        0x964E858C91BA2655u, 0x3A6A07F8D510F86Fu, // 5^-108
+        0xBBE226EFB628AFEAu, 0x890489F70A55368Bu, // 5^-107
+        0xEADAB0ABA3B2DBE5u, 0x2B45AC74CCEA842Eu, // 5^-106
+        0x92C8AE6B464FC96Fu, 0x3B0B8BC90012929Du, // 5^-105
+        0xB77ADA0617E3BBCBu, 0x09CE6EBB40173744u, // 5^-104
+        0xE55990879DDCAABDu, 0xCC420A6A101D0515u, // 5^-103
+        0x8F57FA54C2A9EAB6u, 0x9FA946824A12232Du, // 5^-102
+        0xB32DF8E9F3546564u, 0x47939822DC96ABF9u, // 5^-101
+        0xDFF9772470297EBDu, 0x59787E2B93BC56F7u, // 5^-100
+        0x8BFBEA76C619EF36u, 0x57EB4EDB3C55B65Au, // 5^-99
+        0xAEFAE51477A06B03u, 0xEDE622920B6B23F1u, // 5^-98
+        0xDAB99E59958885C4u, 0xE95FAB368E45ECEDu, // 5^-97
+        0x88B402F7FD75539Bu, 0x11DBCB0218EBB414u, // 5^-96
+        0xAAE103B5FCD2A881u, 0xD652BDC29F26A119u, // 5^-95
+        0xD59944A37C0752A2u, 0x4BE76D3346F0495Fu, // 5^-94
+        0x857FCAE62D8493A5u, 0x6F70A4400C562DDBu, // 5^-93
+        0xA6DFBD9FB8E5B88Eu, 0xCB4CCD500F6BB952u, // 5^-92
+        0xD097AD07A71F26B2u, 0x7E2000A41346A7A7u, // 5^-91
+        0x825ECC24C873782Fu, 0x8ED400668C0C28C8u, // 5^-90
+        0xA2F67F2DFA90563Bu, 0x728900802F0F32FAu, // 5^-89
+        0xCBB41EF979346BCAu, 0x4F2B40A03AD2FFB9u, // 5^-88
+        0xFEA126B7D78186BCu, 0xE2F610C84987BFA8u, // 5^-87
+        0x9F24B832E6B0F436u, 0x0DD9CA7D2DF4D7C9u, // 5^-86
+        0xC6EDE63FA05D3143u, 0x91503D1C79720DBBu, // 5^-85
+        0xF8A95FCF88747D94u, 0x75A44C6397CE912Au, // 5^-84
+        0x9B69DBE1B548CE7Cu, 0xC986AFBE3EE11ABAu, // 5^-83
+        0xC24452DA229B021Bu, 0xFBE85BADCE996168u, // 5^-82
+        0xF2D56790AB41C2A2u, 0xFAE27299423FB9C3u, // 5^-81
+        0x97C560BA6B0919A5u, 0xDCCD879FC967D41Au, // 5^-80
+        0xBDB6B8E905CB600Fu, 0x5400E987BBC1C920u, // 5^-79
+        0xED246723473E3813u, 0x290123E9AAB23B68u, // 5^-78
+        0x9436C0760C86E30Bu, 0xF9A0B6720AAF6521u, // 5^-77
+        0xB94470938FA89BCEu, 0xF808E40E8D5B3E69u, // 5^-76
+        0xE7958CB87392C2C2u, 0xB60B1D1230B20E04u, // 5^-75
+        0x90BD77F3483BB9B9u, 0xB1C6F22B5E6F48C2u, // 5^-74
+        0xB4ECD5F01A4AA828u, 0x1E38AEB6360B1AF3u, // 5^-73
+        0xE2280B6C20DD5232u, 0x25C6DA63C38DE1B0u, // 5^-72
+        0x8D590723948A535Fu, 0x579C487E5A38AD0Eu, // 5^-71
+        0xB0AF48EC79ACE837u, 0x2D835A9DF0C6D851u, // 5^-70
+        0xDCDB1B2798182244u, 0xF8E431456CF88E65u, // 5^-69
+        0x8A08F0F8BF0F156Bu, 0x1B8E9ECB641B58FFu, // 5^-68
+        0xAC8B2D36EED2DAC5u, 0xE272467E3D222F3Fu, // 5^-67
+        0xD7ADF884AA879177u, 0x5B0ED81DCC6ABB0Fu, // 5^-66
+        0x86CCBB52EA94BAEAu, 0x98E947129FC2B4E9u, // 5^-65
+        0xA87FEA27A539E9A5u, 0x3F2398D747B36224u, // 5^-64
+        0xD29FE4B18E88640Eu, 0x8EEC7F0D19A03AADu, // 5^-63
+        0x83A3EEEEF9153E89u, 0x1953CF68300424ACu, // 5^-62
+        0xA48CEAAAB75A8E2Bu, 0x5FA8C3423C052DD7u, // 5^-61
+        0xCDB02555653131B6u, 0x3792F412CB06794Du, // 5^-60
+        0x808E17555F3EBF11u, 0xE2BBD88BBEE40BD0u, // 5^-59
+        0xA0B19D2AB70E6ED6u, 0x5B6ACEAEAE9D0EC4u, // 5^-58
+        0xC8DE047564D20A8Bu, 0xF245825A5A445275u, // 5^-57
+        0xFB158592BE068D2Eu, 0xEED6E2F0F0D56712u, // 5^-56
+        0x9CED737BB6C4183Du, 0x55464DD69685606Bu, // 5^-55
+        0xC428D05AA4751E4Cu, 0xAA97E14C3C26B886u, // 5^-54
+        0xF53304714D9265DFu, 0xD53DD99F4B3066A8u, // 5^-53
+        0x993FE2C6D07B7FABu, 0xE546A8038EFE4029u, // 5^-52
+        0xBF8FDB78849A5F96u, 0xDE98520472BDD033u, // 5^-51
+        0xEF73D256A5C0F77Cu, 0x963E66858F6D4440u, // 5^-50
+        0x95A8637627989AADu, 0xDDE7001379A44AA8u, // 5^-49
+        0xBB127C53B17EC159u, 0x5560C018580D5D52u, // 5^-48
+        0xE9D71B689DDE71AFu, 0xAAB8F01E6E10B4A6u, // 5^-47
+        0x9226712162AB070Du, 0xCAB3961304CA70E8u, // 5^-46
+        0xB6B00D69BB55C8D1u, 0x3D607B97C5FD0D22u, // 5^-45
+        0xE45C10C42A2B3B05u, 0x8CB89A7DB77C506Au, // 5^-44
+        0x8EB98A7A9A5B04E3u, 0x77F3608E92ADB242u, // 5^-43
+        0xB267ED1940F1C61Cu, 0x55F038B237591ED3u, // 5^-42
+        0xDF01E85F912E37A3u, 0x6B6C46DEC52F6688u, // 5^-41
+        0x8B61313BBABCE2C6u, 0x2323AC4B3B3DA015u, // 5^-40
+        0xAE397D8AA96C1B77u, 0xABEC975E0A0D081Au, // 5^-39
+        0xD9C7DCED53C72255u, 0x96E7BD358C904A21u, // 5^-38
+        0x881CEA14545C7575u, 0x7E50D64177DA2E54u, // 5^-37
+        0xAA242499697392D2u, 0xDDE50BD1D5D0B9E9u, // 5^-36
+        0xD4AD2DBFC3D07787u, 0x955E4EC64B44E864u, // 5^-35
+        0x84EC3C97DA624AB4u, 0xBD5AF13BEF0B113Eu, // 5^-34
+        0xA6274BBDD0FADD61u, 0xECB1AD8AEACDD58Eu, // 5^-33
+        0xCFB11EAD453994BAu, 0x67DE18EDA5814AF2u, // 5^-32
+        0x81CEB32C4B43FCF4u, 0x80EACF948770CED7u, // 5^-31
+        0xA2425FF75E14FC31u, 0xA1258379A94D028Du, // 5^-30
+        0xCAD2F7F5359A3B3Eu, 0x096EE45813A04330u, // 5^-29
+        0xFD87B5F28300CA0Du, 0x8BCA9D6E188853FCu, // 5^-28
+        0x9E74D1B791E07E48u, 0x775EA264CF55347Eu, // 5^-27
+        0xC612062576589DDAu, 0x95364AFE032A819Eu, // 5^-26
+        0xF79687AED3EEC551u, 0x3A83DDBD83F52205u, // 5^-25
+        0x9ABE14CD44753B52u, 0xC4926A9672793543u, // 5^-24
+        0xC16D9A0095928A27u, 0x75B7053C0F178294u, // 5^-23
+        0xF1C90080BAF72CB1u, 0x5324C68B12DD6339u, // 5^-22
+        0x971DA05074DA7BEEu, 0xD3F6FC16EBCA5E04u, // 5^-21
+        0xBCE5086492111AEAu, 0x88F4BB1CA6BCF585u, // 5^-20
+        0xEC1E4A7DB69561A5u, 0x2B31E9E3D06C32E6u, // 5^-19
+        0x9392EE8E921D5D07u, 0x3AFF322E62439FD0u, // 5^-18
+        0xB877AA3236A4B449u, 0x09BEFEB9FAD487C3u, // 5^-17
+        0xE69594BEC44DE15Bu, 0x4C2EBE687989A9B4u, // 5^-16
+        0x901D7CF73AB0ACD9u, 0x0F9D37014BF60A11u, // 5^-15
+        0xB424DC35095CD80Fu, 0x538484C19EF38C95u, // 5^-14
+        0xE12E13424BB40E13u, 0x2865A5F206B06FBAu, // 5^-13
+        0x8CBCCC096F5088CBu, 0xF93F87B7442E45D4u, // 5^-12
+        0xAFEBFF0BCB24AAFEu, 0xF78F69A51539D749u, // 5^-11
+        0xDBE6FECEBDEDD5BEu, 0xB573440E5A884D1Cu, // 5^-10
+        0x89705F4136B4A597u, 0x31680A88F8953031u, // 5^-9
+        0xABCC77118461CEFCu, 0xFDC20D2B36BA7C3Eu, // 5^-8
+        0xD6BF94D5E57A42BCu, 0x3D32907604691B4Du, // 5^-7
+        0x8637BD05AF6C69B5u, 0xA63F9A49C2C1B110u, // 5^-6
+        0xA7C5AC471B478423u, 0x0FCF80DC33721D54u, // 5^-5
+        0xD1B71758E219652Bu, 0xD3C36113404EA4A9u, // 5^-4
+        0x83126E978D4FDF3Bu, 0x645A1CAC083126EAu, // 5^-3
+        0xA3D70A3D70A3D70Au, 0x3D70A3D70A3D70A4u, // 5^-2
+        0xCCCCCCCCCCCCCCCCu, 0xCCCCCCCCCCCCCCCDu, // 5^-1
+        0x8000000000000000u, 0x0000000000000000u, // 5^0
+        0xA000000000000000u, 0x0000000000000000u, // 5^1
+        0xC800000000000000u, 0x0000000000000000u, // 5^2
+        0xFA00000000000000u, 0x0000000000000000u, // 5^3
+        0x9C40000000000000u, 0x0000000000000000u, // 5^4
+        0xC350000000000000u, 0x0000000000000000u, // 5^5
+        0xF424000000000000u, 0x0000000000000000u, // 5^6
+        0x9896800000000000u, 0x0000000000000000u, // 5^7
+        0xBEBC200000000000u, 0x0000000000000000u, // 5^8
+        0xEE6B280000000000u, 0x0000000000000000u, // 5^9
+        0x9502F90000000000u, 0x0000000000000000u, // 5^10
+        0xBA43B74000000000u, 0x0000000000000000u, // 5^11
+        0xE8D4A51000000000u, 0x0000000000000000u, // 5^12
+        0x9184E72A00000000u, 0x0000000000000000u, // 5^13
+        0xB5E620F480000000u, 0x0000000000000000u, // 5^14
+        0xE35FA931A0000000u, 0x0000000000000000u, // 5^15
+        0x8E1BC9BF04000000u, 0x0000000000000000u, // 5^16
+        0xB1A2BC2EC5000000u, 0x0000000000000000u, // 5^17
+        0xDE0B6B3A76400000u, 0x0000000000000000u, // 5^18
+        0x8AC7230489E80000u, 0x0000000000000000u, // 5^19
+        0xAD78EBC5AC620000u, 0x0000000000000000u, // 5^20
+        0xD8D726B7177A8000u, 0x0000000000000000u, // 5^21
+        0x878678326EAC9000u, 0x0000000000000000u, // 5^22
+        0xA968163F0A57B400u, 0x0000000000000000u, // 5^23
+        0xD3C21BCECCEDA100u, 0x0000000000000000u, // 5^24
+        0x84595161401484A0u, 0x0000000000000000u, // 5^25
+        0xA56FA5B99019A5C8u, 0x0000000000000000u, // 5^26
+        0xCECB8F27F4200F3Au, 0x0000000000000000u, // 5^27
+        0x813F3978F8940984u, 0x4000000000000000u, // 5^28
+        0xA18F07D736B90BE5u, 0x5000000000000000u, // 5^29
+        0xC9F2C9CD04674EDEu, 0xA400000000000000u, // 5^30
+        0xFC6F7C4045812296u, 0x4D00000000000000u, // 5^31
+        0x9DC5ADA82B70B59Du, 0xF020000000000000u, // 5^32
+        0xC5371912364CE305u, 0x6C28000000000000u, // 5^33
+        0xF684DF56C3E01BC6u, 0xC732000000000000u, // 5^34
+        0x9A130B963A6C115Cu, 0x3C7F400000000000u, // 5^35
+        0xC097CE7BC90715B3u, 0x4B9F100000000000u, // 5^36
+        0xF0BDC21ABB48DB20u, 0x1E86D40000000000u, // 5^37
+        0x96769950B50D88F4u, 0x1314448000000000u, // 5^38
+        0xBC143FA4E250EB31u, 0x17D955A000000000u, // 5^39
+        0xEB194F8E1AE525FDu, 0x5DCFAB0800000000u, // 5^40
+        0x92EFD1B8D0CF37BEu, 0x5AA1CAE500000000u, // 5^41
+        0xB7ABC627050305ADu, 0xF14A3D9E40000000u, // 5^42
+        0xE596B7B0C643C719u, 0x6D9CCD05D0000000u, // 5^43
+        0x8F7E32CE7BEA5C6Fu, 0xE4820023A2000000u, // 5^44
+        0xB35DBF821AE4F38Bu, 0xDDA2802C8A800000u, // 5^45
+        0xE0352F62A19E306Eu, 0xD50B2037AD200000u, // 5^46
+        0x8C213D9DA502DE45u, 0x4526F422CC340000u, // 5^47
+        0xAF298D050E4395D6u, 0x9670B12B7F410000u, // 5^48
+        0xDAF3F04651D47B4Cu, 0x3C0CDD765F114000u, // 5^49
+        0x88D8762BF324CD0Fu, 0xA5880A69FB6AC800u, // 5^50
+        0xAB0E93B6EFEE0053u, 0x8EEA0D047A457A00u, // 5^51
+        0xD5D238A4ABE98068u, 0x72A4904598D6D880u, // 5^52
+        0x85A36366EB71F041u, 0x47A6DA2B7F864750u, // 5^53
+        0xA70C3C40A64E6C51u, 0x999090B65F67D924u, // 5^54
+        0xD0CF4B50CFE20765u, 0xFFF4B4E3F741CF6Du, // 5^55
+        0x82818F1281ED449Fu, 0xBFF8F10E7A8921A4u, // 5^56
+        0xA321F2D7226895C7u, 0xAFF72D52192B6A0Du, // 5^57
+        0xCBEA6F8CEB02BB39u, 0x9BF4F8A69F764490u, // 5^58
+        0xFEE50B7025C36A08u, 0x02F236D04753D5B4u, // 5^59
+        0x9F4F2726179A2245u, 0x01D762422C946590u, // 5^60
+        0xC722F0EF9D80AAD6u, 0x424D3AD2B7B97EF5u, // 5^61
+        0xF8EBAD2B84E0D58Bu, 0xD2E0898765A7DEB2u, // 5^62
+        0x9B934C3B330C8577u, 0x63CC55F49F88EB2Fu, // 5^63
+        0xC2781F49FFCFA6D5u, 0x3CBF6B71C76B25FBu, // 5^64
+        0xF316271C7FC3908Au, 0x8BEF464E3945EF7Au, // 5^65
+        0x97EDD871CFDA3A56u, 0x97758BF0E3CBB5ACu, // 5^66
+        0xBDE94E8E43D0C8ECu, 0x3D52EEED1CBEA317u, // 5^67
+        0xED63A231D4C4FB27u, 0x4CA7AAA863EE4BDDu, // 5^68
+        0x945E455F24FB1CF8u, 0x8FE8CAA93E74EF6Au, // 5^69
+        0xB975D6B6EE39E436u, 0xB3E2FD538E122B44u, // 5^70
+        0xE7D34C64A9C85D44u, 0x60DBBCA87196B616u, // 5^71
+        0x90E40FBEEA1D3A4Au, 0xBC8955E946FE31CDu, // 5^72
+        0xB51D13AEA4A488DDu, 0x6BABAB6398BDBE41u, // 5^73
+        0xE264589A4DCDAB14u, 0xC696963C7EED2DD1u, // 5^74
+        0x8D7EB76070A08AECu, 0xFC1E1DE5CF543CA2u, // 5^75
+        0xB0DE65388CC8ADA8u, 0x3B25A55F43294BCBu, // 5^76
+        0xDD15FE86AFFAD912u, 0x49EF0EB713F39EBEu, // 5^77
+        0x8A2DBF142DFCC7ABu, 0x6E3569326C784337u, // 5^78
+        0xACB92ED9397BF996u, 0x49C2C37F07965404u, // 5^79
+        0xD7E77A8F87DAF7FBu, 0xDC33745EC97BE906u, // 5^80
+        0x86F0AC99B4E8DAFDu, 0x69A028BB3DED71A3u, // 5^81
+        0xA8ACD7C0222311BCu, 0xC40832EA0D68CE0Cu, // 5^82
+        0xD2D80DB02AABD62Bu, 0xF50A3FA490C30190u, // 5^83
+        0x83C7088E1AAB65DBu, 0x792667C6DA79E0FAu, // 5^84
+        0xA4B8CAB1A1563F52u, 0x577001B891185938u, // 5^85
+        0xCDE6FD5E09ABCF26u, 0xED4C0226B55E6F86u, // 5^86
+        0x80B05E5AC60B6178u, 0x544F8158315B05B4u, // 5^87
+        0xA0DC75F1778E39D6u, 0x696361AE3DB1C721u, // 5^88
+        0xC913936DD571C84Cu, 0x03BC3A19CD1E38E9u, // 5^89
+        0xFB5878494ACE3A5Fu, 0x04AB48A04065C723u, // 5^90
+        0x9D174B2DCEC0E47Bu, 0x62EB0D64283F9C76u, // 5^91
+        0xC45D1DF942711D9Au, 0x3BA5D0BD324F8394u, // 5^92
+        0xF5746577930D6500u, 0xCA8F44EC7EE36479u, // 5^93
+        0x9968BF6ABBE85F20u, 0x7E998B13CF4E1ECBu, // 5^94
+        0xBFC2EF456AE276E8u, 0x9E3FEDD8C321A67Eu, // 5^95
+        0xEFB3AB16C59B14A2u, 0xC5CFE94EF3EA101Eu, // 5^96
+        0x95D04AEE3B80ECE5u, 0xBBA1F1D158724A12u, // 5^97
+        0xBB445DA9CA61281Fu, 0x2A8A6E45AE8EDC97u, // 5^98
+        0xEA1575143CF97226u, 0xF52D09D71A3293BDu, // 5^99
+        0x924D692CA61BE758u, 0x593C2626705F9C56u, // 5^100
+        0xB6E0C377CFA2E12Eu, 0x6F8B2FB00C77836Cu, // 5^101
+        0xE498F455C38B997Au, 0x0B6DFB9C0F956447u, // 5^102
+        0x8EDF98B59A373FECu, 0x4724BD4189BD5EACu, // 5^103
+        0xB2977EE300C50FE7u, 0x58EDEC91EC2CB657u, // 5^104
+        0xDF3D5E9BC0F653E1u, 0x2F2967B66737E3EDu, // 5^105
+        0x8B865B215899F46Cu, 0xBD79E0D20082EE74u, // 5^106
+        0xAE67F1E9AEC07187u, 0xECD8590680A3AA11u, // 5^107
+        0xDA01EE641A708DE9u, 0xE80E6F4820CC9495u, // 5^108
+        0x884134FE908658B2u, 0x3109058D147FDCDDu, // 5^109
+        0xAA51823E34A7EEDEu, 0xBD4B46F0599FD415u, // 5^110
+        0xD4E5E2CDC1D1EA96u, 0x6C9E18AC7007C91Au, // 5^111
+        0x850FADC09923329Eu, 0x03E2CF6BC604DDB0u, // 5^112
+        0xA6539930BF6BFF45u, 0x84DB8346B786151Cu, // 5^113
+        0xCFE87F7CEF46FF16u, 0xE612641865679A63u, // 5^114
+        0x81F14FAE158C5F6Eu, 0x4FCB7E8F3F60C07Eu, // 5^115
+        0xA26DA3999AEF7749u, 0xE3BE5E330F38F09Du, // 5^116
+        0xCB090C8001AB551Cu, 0x5CADF5BFD3072CC5u, // 5^117
+        0xFDCB4FA002162A63u, 0x73D9732FC7C8F7F6u, // 5^118
+        0x9E9F11C4014DDA7Eu, 0x2867E7FDDCDD9AFAu, // 5^119
+        0xC646D63501A1511Du, 0xB281E1FD541501B8u, // 5^120
+        0xF7D88BC24209A565u, 0x1F225A7CA91A4226u, // 5^121
+        0x9AE757596946075Fu, 0x3375788DE9B06958u, // 5^122
+        0xC1A12D2FC3978937u, 0x0052D6B1641C83AEu, // 5^123
+        0xF209787BB47D6B84u, 0xC0678C5DBD23A49Au, // 5^124
+        0x9745EB4D50CE6332u, 0xF840B7BA963646E0u, // 5^125
+        0xBD176620A501FBFFu, 0xB650E5A93BC3D898u, // 5^126
+        0xEC5D3FA8CE427AFFu, 0xA3E51F138AB4CEBEu, // 5^127
+        0x93BA47C980E98CDFu, 0xC66F336C36B10137u, // 5^128
+        0xB8A8D9BBE123F017u, 0xB80B0047445D4184u, // 5^129
+        0xE6D3102AD96CEC1Du, 0xA60DC059157491E5u, // 5^130
+        0x9043EA1AC7E41392u, 0x87C89837AD68DB2Fu, // 5^131
+        0xB454E4A179DD1877u, 0x29BABE4598C311FBu, // 5^132
+        0xE16A1DC9D8545E94u, 0xF4296DD6FEF3D67Au, // 5^133
+        0x8CE2529E2734BB1Du, 0x1899E4A65F58660Cu, // 5^134
+        0xB01AE745B101E9E4u, 0x5EC05DCFF72E7F8Fu, // 5^135
+        0xDC21A1171D42645Du, 0x76707543F4FA1F73u, // 5^136
+        0x899504AE72497EBAu, 0x6A06494A791C53A8u, // 5^137
+        0xABFA45DA0EDBDE69u, 0x0487DB9D17636892u, // 5^138
+        0xD6F8D7509292D603u, 0x45A9D2845D3C42B6u, // 5^139
+        0x865B86925B9BC5C2u, 0x0B8A2392BA45A9B2u, // 5^140
+        0xA7F26836F282B732u, 0x8E6CAC7768D7141Eu, // 5^141
+        0xD1EF0244AF2364FFu, 0x3207D795430CD926u, // 5^142
+        0x8335616AED761F1Fu, 0x7F44E6BD49E807B8u, // 5^143
+        0xA402B9C5A8D3A6E7u, 0x5F16206C9C6209A6u, // 5^144
+        0xCD036837130890A1u, 0x36DBA887C37A8C0Fu, // 5^145
+        0x802221226BE55A64u, 0xC2494954DA2C9789u, // 5^146
+        0xA02AA96B06DEB0FDu, 0xF2DB9BAA10B7BD6Cu, // 5^147
+        0xC83553C5C8965D3Du, 0x6F92829494E5ACC7u, // 5^148
+        0xFA42A8B73ABBF48Cu, 0xCB772339BA1F17F9u, // 5^149
+        0x9C69A97284B578D7u, 0xFF2A760414536EFBu, // 5^150
+        0xC38413CF25E2D70Du, 0xFEF5138519684ABAu, // 5^151
+        0xF46518C2EF5B8CD1u, 0x7EB258665FC25D69u, // 5^152
+        0x98BF2F79D5993802u, 0xEF2F773FFBD97A61u, // 5^153
+        0xBEEEFB584AFF8603u, 0xAAFB550FFACFD8FAu, // 5^154
+        0xEEAABA2E5DBF6784u, 0x95BA2A53F983CF38u, // 5^155
+        0x952AB45CFA97A0B2u, 0xDD945A747BF26183u, // 5^156
+        0xBA756174393D88DFu, 0x94F971119AEEF9E4u, // 5^157
+        0xE912B9D1478CEB17u, 0x7A37CD5601AAB85Du, // 5^158
+        0x91ABB422CCB812EEu, 0xAC62E055C10AB33Au, // 5^159
+        0xB616A12B7FE617AAu, 0x577B986B314D6009u, // 5^160
+        0xE39C49765FDF9D94u, 0xED5A7E85FDA0B80Bu, // 5^161
+        0x8E41ADE9FBEBC27Du, 0x14588F13BE847307u, // 5^162
+        0xB1D219647AE6B31Cu, 0x596EB2D8AE258FC8u, // 5^163
+        0xDE469FBD99A05FE3u, 0x6FCA5F8ED9AEF3BBu, // 5^164
+        0x8AEC23D680043BEEu, 0x25DE7BB9480D5854u, // 5^165
+        0xADA72CCC20054AE9u, 0xAF561AA79A10AE6Au, // 5^166
+        0xD910F7FF28069DA4u, 0x1B2BA1518094DA04u, // 5^167
+        0x87AA9AFF79042286u, 0x90FB44D2F05D0842u, // 5^168
+        0xA99541BF57452B28u, 0x353A1607AC744A53u, // 5^169
+        0xD3FA922F2D1675F2u, 0x42889B8997915CE8u, // 5^170
+        0x847C9B5D7C2E09B7u, 0x69956135FEBADA11u, // 5^171
+        0xA59BC234DB398C25u, 0x43FAB9837E699095u, // 5^172
+        0xCF02B2C21207EF2Eu, 0x94F967E45E03F4BBu, // 5^173
+        0x8161AFB94B44F57Du, 0x1D1BE0EEBAC278F5u, // 5^174
+        0xA1BA1BA79E1632DCu, 0x6462D92A69731732u, // 5^175
+        0xCA28A291859BBF93u, 0x7D7B8F7503CFDCFEu, // 5^176
+        0xFCB2CB35E702AF78u, 0x5CDA735244C3D43Eu, // 5^177
+        0x9DEFBF01B061ADABu, 0x3A0888136AFA64A7u, // 5^178
+        0xC56BAEC21C7A1916u, 0x088AAA1845B8FDD0u, // 5^179
+        0xF6C69A72A3989F5Bu, 0x8AAD549E57273D45u, // 5^180
+        0x9A3C2087A63F6399u, 0x36AC54E2F678864Bu, // 5^181
+        0xC0CB28A98FCF3C7Fu, 0x84576A1BB416A7DDu, // 5^182
+        0xF0FDF2D3F3C30B9Fu, 0x656D44A2A11C51D5u, // 5^183
+        0x969EB7C47859E743u, 0x9F644AE5A4B1B325u, // 5^184
+        0xBC4665B596706114u, 0x873D5D9F0DDE1FEEu, // 5^185
+        0xEB57FF22FC0C7959u, 0xA90CB506D155A7EAu, // 5^186
+        0x9316FF75DD87CBD8u, 0x09A7F12442D588F2u, // 5^187
+        0xB7DCBF5354E9BECEu, 0x0C11ED6D538AEB2Fu, // 5^188
+        0xE5D3EF282A242E81u, 0x8F1668C8A86DA5FAu, // 5^189
+        0x8FA475791A569D10u, 0xF96E017D694487BCu, // 5^190
+        0xB38D92D760EC4455u, 0x37C981DCC395A9ACu, // 5^191
+        0xE070F78D3927556Au, 0x85BBE253F47B1417u, // 5^192
+        0x8C469AB843B89562u, 0x93956D7478CCEC8Eu, // 5^193
+        0xAF58416654A6BABBu, 0x387AC8D1970027B2u, // 5^194
+        0xDB2E51BFE9D0696Au, 0x06997B05FCC0319Eu, // 5^195
+        0x88FCF317F22241E2u, 0x441FECE3BDF81F03u, // 5^196
+        0xAB3C2FDDEEAAD25Au, 0xD527E81CAD7626C3u, // 5^197
+        0xD60B3BD56A5586F1u, 0x8A71E223D8D3B074u, // 5^198
+        0x85C7056562757456u, 0xF6872D5667844E49u, // 5^199
+        0xA738C6BEBB12D16Cu, 0xB428F8AC016561DBu, // 5^200
+        0xD106F86E69D785C7u, 0xE13336D701BEBA52u, // 5^201
+        0x82A45B450226B39Cu, 0xECC0024661173473u, // 5^202
+        0xA34D721642B06084u, 0x27F002D7F95D0190u, // 5^203
+        0xCC20CE9BD35C78A5u, 0x31EC038DF7B441F4u, // 5^204
+        0xFF290242C83396CEu, 0x7E67047175A15271u, // 5^205
+        0x9F79A169BD203E41u, 0x0F0062C6E984D386u, // 5^206
+        0xC75809C42C684DD1u, 0x52C07B78A3E60868u, // 5^207
+        0xF92E0C3537826145u, 0xA7709A56CCDF8A82u, // 5^208
+        0x9BBCC7A142B17CCBu, 0x88A66076400BB691u, // 5^209
+        0xC2ABF989935DDBFEu, 0x6ACFF893D00EA435u, // 5^210
+        0xF356F7EBF83552FEu, 0x0583F6B8C4124D43u, // 5^211
+        0x98165AF37B2153DEu, 0xC3727A337A8B704Au, // 5^212
+        0xBE1BF1B059E9A8D6u, 0x744F18C0592E4C5Cu, // 5^213
+        0xEDA2EE1C7064130Cu, 0x1162DEF06F79DF73u, // 5^214
+        0x9485D4D1C63E8BE7u, 0x8ADDCB5645AC2BA8u, // 5^215
+        0xB9A74A0637CE2EE1u, 0x6D953E2BD7173692u, // 5^216
+        0xE8111C87C5C1BA99u, 0xC8FA8DB6CCDD0437u, // 5^217
+        0x910AB1D4DB9914A0u, 0x1D9C9892400A22A2u, // 5^218
+        0xB54D5E4A127F59C8u, 0x2503BEB6D00CAB4Bu, // 5^219
+        0xE2A0B5DC971F303Au, 0x2E44AE64840FD61Du, // 5^220
+        0x8DA471A9DE737E24u, 0x5CEAECFED289E5D2u, // 5^221
+        0xB10D8E1456105DADu, 0x7425A83E872C5F47u, // 5^222
+        0xDD50F1996B947518u, 0xD12F124E28F77719u, // 5^223
+        0x8A5296FFE33CC92Fu, 0x82BD6B70D99AAA6Fu, // 5^224
+        0xACE73CBFDC0BFB7Bu, 0x636CC64D1001550Bu, // 5^225
+        0xD8210BEFD30EFA5Au, 0x3C47F7E05401AA4Eu, // 5^226
+        0x8714A775E3E95C78u, 0x65ACFAEC34810A71u, // 5^227
+        0xA8D9D1535CE3B396u, 0x7F1839A741A14D0Du, // 5^228
+        0xD31045A8341CA07Cu, 0x1EDE48111209A050u, // 5^229
+        0x83EA2B892091E44Du, 0x934AED0AAB460432u, // 5^230
+        0xA4E4B66B68B65D60u, 0xF81DA84D5617853Fu, // 5^231
+        0xCE1DE40642E3F4B9u, 0x36251260AB9D668Eu, // 5^232
+        0x80D2AE83E9CE78F3u, 0xC1D72B7C6B426019u, // 5^233
+        0xA1075A24E4421730u, 0xB24CF65B8612F81Fu, // 5^234
+        0xC94930AE1D529CFCu, 0xDEE033F26797B627u, // 5^235
+        0xFB9B7CD9A4A7443Cu, 0x169840EF017DA3B1u, // 5^236
+        0x9D412E0806E88AA5u, 0x8E1F289560EE864Eu, // 5^237
+        0xC491798A08A2AD4Eu, 0xF1A6F2BAB92A27E2u, // 5^238
+        0xF5B5D7EC8ACB58A2u, 0xAE10AF696774B1DBu, // 5^239
+        0x9991A6F3D6BF1765u, 0xACCA6DA1E0A8EF29u, // 5^240
+        0xBFF610B0CC6EDD3Fu, 0x17FD090A58D32AF3u, // 5^241
+        0xEFF394DCFF8A948Eu, 0xDDFC4B4CEF07F5B0u, // 5^242
+        0x95F83D0A1FB69CD9u, 0x4ABDAF101564F98Eu, // 5^243
+        0xBB764C4CA7A4440Fu, 0x9D6D1AD41ABE37F1u, // 5^244
+        0xEA53DF5FD18D5513u, 0x84C86189216DC5EDu, // 5^245
+        0x92746B9BE2F8552Cu, 0x32FD3CF5B4E49BB4u, // 5^246
+        0xB7118682DBB66A77u, 0x3FBC8C33221DC2A1u, // 5^247
+        0xE4D5E82392A40515u, 0x0FABAF3FEAA5334Au, // 5^248
+        0x8F05B1163BA6832Du, 0x29CB4D87F2A7400Eu, // 5^249
+        0xB2C71D5BCA9023F8u, 0x743E20E9EF511012u, // 5^250
+        0xDF78E4B2BD342CF6u, 0x914DA9246B255416u, // 5^251
+        0x8BAB8EEFB6409C1Au, 0x1AD089B6C2F7548Eu, // 5^252
+        0xAE9672ABA3D0C320u, 0xA184AC2473B529B1u, // 5^253
+        0xDA3C0F568CC4F3E8u, 0xC9E5D72D90A2741Eu, // 5^254
+        0x8865899617FB1871u, 0x7E2FA67C7A658892u, // 5^255
+        0xAA7EEBFB9DF9DE8Du, 0xDDBB901B98FEEAB7u, // 5^256
+        0xD51EA6FA85785631u, 0x552A74227F3EA565u, // 5^257
+        0x8533285C936B35DEu, 0xD53A88958F87275Fu, // 5^258
+        0xA67FF273B8460356u, 0x8A892ABAF368F137u, // 5^259
+        0xD01FEF10A657842Cu, 0x2D2B7569B0432D85u, // 5^260
+        0x8213F56A67F6B29Bu, 0x9C3B29620E29FC73u, // 5^261
+        0xA298F2C501F45F42u, 0x8349F3BA91B47B8Fu, // 5^262
+        0xCB3F2F7642717713u, 0x241C70A936219A73u, // 5^263
+        0xFE0EFB53D30DD4D7u, 0xED238CD383AA0110u, // 5^264
+        0x9EC95D1463E8A506u, 0xF4363804324A40AAu, // 5^265
+        0xC67BB4597CE2CE48u, 0xB143C6053EDCD0D5u, // 5^266
+        0xF81AA16FDC1B81DAu, 0xDD94B7868E94050Au, // 5^267
+        0x9B10A4E5E9913128u, 0xCA7CF2B4191C8326u, // 5^268
+        0xC1D4CE1F63F57D72u, 0xFD1C2F611F63A3F0u, // 5^269
+        0xF24A01A73CF2DCCFu, 0xBC633B39673C8CECu, // 5^270
+        0x976E41088617CA01u, 0xD5BE0503E085D813u, // 5^271
+        0xBD49D14AA79DBC82u, 0x4B2D8644D8A74E18u, // 5^272
+        0xEC9C459D51852BA2u, 0xDDF8E7D60ED1219Eu, // 5^273
+        0x93E1AB8252F33B45u, 0xCABB90E5C942B503u, // 5^274
+        0xB8DA1662E7B00A17u, 0x3D6A751F3B936243u, // 5^275
+        0xE7109BFBA19C0C9Du, 0x0CC512670A783AD4u, // 5^276
+        0x906A617D450187E2u, 0x27FB2B80668B24C5u, // 5^277
+        0xB484F9DC9641E9DAu, 0xB1F9F660802DEDF6u, // 5^278
+        0xE1A63853BBD26451u, 0x5E7873F8A0396973u, // 5^279
+        0x8D07E33455637EB2u, 0xDB0B487B6423E1E8u, // 5^280
+        0xB049DC016ABC5E5Fu, 0x91CE1A9A3D2CDA62u, // 5^281
+        0xDC5C5301C56B75F7u, 0x7641A140CC7810FBu, // 5^282
+        0x89B9B3E11B6329BAu, 0xA9E904C87FCB0A9Du, // 5^283
+        0xAC2820D9623BF429u, 0x546345FA9FBDCD44u, // 5^284
+        0xD732290FBACAF133u, 0xA97C177947AD4095u, // 5^285
+        0x867F59A9D4BED6C0u, 0x49ED8EABCCCC485Du, // 5^286
+        0xA81F301449EE8C70u, 0x5C68F256BFFF5A74u, // 5^287
+        0xD226FC195C6A2F8Cu, 0x73832EEC6FFF3111u, // 5^288
+        0x83585D8FD9C25DB7u, 0xC831FD53C5FF7EABu, // 5^289
+        0xA42E74F3D032F525u, 0xBA3E7CA8B77F5E55u, // 5^290
+        0xCD3A1230C43FB26Fu, 0x28CE1BD2E55F35EBu, // 5^291
+        0x80444B5E7AA7CF85u, 0x7980D163CF5B81B3u, // 5^292
+        0xA0555E361951C366u, 0xD7E105BCC332621Fu, // 5^293
+        0xC86AB5C39FA63440u, 0x8DD9472BF3FEFAA7u, // 5^294
+        0xFA856334878FC150u, 0xB14F98F6F0FEB951u, // 5^295
+        0x9C935E00D4B9D8D2u, 0x6ED1BF9A569F33D3u, // 5^296
+        0xC3B8358109E84F07u, 0x0A862F80EC4700C8u, // 5^297
+        0xF4A642E14C6262C8u, 0xCD27BB612758C0FAu, // 5^298
+        0x98E7E9CCCFBD7DBDu, 0x8038D51CB897789Cu, // 5^299
+        0xBF21E44003ACDD2Cu, 0xE0470A63E6BD56C3u, // 5^300
+        0xEEEA5D5004981478u, 0x1858CCFCE06CAC74u, // 5^301
+        0x95527A5202DF0CCBu, 0x0F37801E0C43EBC8u, // 5^302
+        0xBAA718E68396CFFDu, 0xD30560258F54E6BAu, // 5^303
+        0xE950DF20247C83FDu, 0x47C6B82EF32A2069u, // 5^304
+        0x91D28B7416CDD27Eu, 0x4CDC331D57FA5441u, // 5^305
+        0xB6472E511C81471Du, 0xE0133FE4ADF8E952u, // 5^306
+        0xE3D8F9E563A198E5u, 0x58180FDDD97723A6u, // 5^307
+        0x8E679C2F5E44FF8Fu, 0x570F09EAA7EA7648u, // 5^308
+    };
+
+    ///
+    /// @return the high half of the 128 bit product of `a` and `b`; the low half is stored in `lo`
+    ///
+    [[nodiscard]] inline u64 _multiply128(const u64 a, const u64 b, u64 & lo)
+    {
+      #if defined(_MSC_VER) && !defined(__clang__)
+        u64 hi;
+        lo = _umul128(a, b, &hi);
+        return hi;
+      #else
+        // The extension keyword keeps pedantic builds quiet about the non-standard type
+        __extension__ using u128 = unsigned __int128;
+        const u128 product{static_cast<u128>(a) * b};
+        lo = u64(product);
+        return u64(product >> 64);
+      #endif
+    }
+
+    ///
+    /// Computes the double nearest to `w * 10^q` using the Eisel-Lemire algorithm
+    /// @param w nonzero significand of no more than 19 decimal digits
+    /// @param q power of ten; must be in range [`_minPowerOf10`, `_maxPowerOf10`]
+    /// @param dst set to the result on success
+    /// @return whether the result is a normal finite double; subnormals, zero, and infinity are not handled
+    ///
+    [[nodiscard]] inline bool _eiselLemire(u64 w, const s64 q, f64 & dst)
+    {
+        static constexpr s64 mantissaBits{52};
+        static constexpr s64 exponentBias{1023};
+        static constexpr s64 infinityExponent{0x7FF};
+        static constexpr u64 precisionMask{~u64(0u) >> (mantissaBits + 3)};
+
+        const s64 leadingZeroes{std::countl_zero(w)};
+        w <<= leadingZeroes;
+
+        // Multiply by the high half of the power of five, using the low half only if the result could be affected
+        const u64 index{2u * u64(q - _minPowerOf10)};
+        u64 lo;
+        u64 hi{_multiply128(w, _powersOf5[index], lo)};
+        if ((hi & precisionMask) == precisionMask)
+        {
+            u64 lo2;
+            const u64 hi2{_multiply128(w, _powersOf5[index + 1u], lo2)};
+            lo += hi2;
+            hi += hi2 > lo;
+        }
+
+        const u64 upperBit{hi >> 63};
+        const u64 shift{upperBit + 64u - mantissaBits - 3u};
+        u64 mantissa{hi >> shift};
+
+        // `((152170 + 65536) * q) >> 16` is `floor(log2(10^q))` for all `q` in range
+        s64 exponent{(((152170 + 65536) * q) >> 16) + 63 + s64(upperBit) - leadingZeroes + exponentBias};
+
+        if (exponent <= 0)
+        {
+            return false;
         }
 
-        const std::from_chars_result res{std::from_chars(_pos, _cachedEnd, dst)};
+        // The product may lie exactly halfway between two doubles, which is only possible for small powers, in which
+        //   case round to even
+        if (lo <= 1u && q >= -4 && q <= 23 && (mantissa & 3u) == 1u && (mantissa << shift) == hi)
+        {
+            mantissa &= ~u64(1u);
+        }
+
+        // Round, accounting for the mantissa overflowing into the next exponent
+        mantissa += mantissa & 1u;
+        mantissa >>= 1;
+        if (mantissa >= (u64(2u) << mantissaBits))
+        {
+            mantissa = u64(1u) << mantissaBits;
+            ++exponent;
+        }
+        mantissa &= ~(u64(1u) << mantissaBits);
 
-        // There was an issue parsing
-        if (res.ec != std::errc{})
+        if (exponent >= infinityExponent)
         {
-            errorMessage = "Invalid floater"sv;
             return false;
         }
 
+        dst = std::bit_cast<f64>((u64(exponent) << mantissaBits) | mantissa);
+        return true;
+    }
+
+    inline bool Decoder::_consumeFloater(f64 & dst, const char * const start, u64 significand)
+    {
+        static constexpr f64 exactPowersOf10[23u]{1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+        // The integer digits have already been consumed into the significand
+        const char * end{_pos};
+        u64 digits{u64(end - start)};
+        s64 exponent{0};
+
+        // Continue accumulating digits into the significand, adjusting the exponent for those after the decimal point
+        if (*end == '.')
+        {
+            ++end;
+            const char * const fractionStart{end};
+            while (_private::isDigit(*end))
+            {
+                significand = significand * 10u + u64(*end - '0');
+                ++end;
+            }
+            digits += u64(end - fractionStart);
+            exponent = fractionStart - end;
+        }
+
+        // Consume exponent, which is only part of the number if it has digits
+        if (*end == 'e' || *end == 'E')
+        {
+            const char * exponentPos{end + 1};
+            const bool exponentNegative{*exponentPos == '-'};
+            if (*exponentPos == '-' || *exponentPos == '+')
+            {
+                ++exponentPos;
+            }
+
+            if (_private::isDigit(*exponentPos))
+            {
+                // Saturate well beyond any meaningful exponent
+                s64 explicitExponent{0};
+                while (_private::isDigit(*exponentPos))
+                {
+                    if (explicitExponent < 100'000)
+                    {
+                        explicitExponent = explicitExponent * 10 + (*exponentPos - '0');
+                    }
+                    ++exponentPos;
+                }
+
+                exponent += exponentNegative ? -explicitExponent : explicitExponent;
+                end = exponentPos;
+            }
+        }
+
+        // Fast paths require the significand to not have overflowed
+        bool done{false};
+        if (digits <= 19u)
+        {
+            if (!significand)
+            {
+                dst = 0.0;
+                done = true;
+            }
+            // Both the significand and power of ten are exactly representable, so one correctly rounded operation
+            //   gives the correctly rounded result
+            else if (exponent >= -22 && exponent <= 22 && significand <= (u64(1u) << 53))
+            {
+                dst = f64(significand);
+                dst = exponent < 0 ? dst / exactPowersOf10[-exponent] : dst * exactPowersOf10[exponent];
+                done = true;
+            }
+            else if (exponent >= _minPowerOf10 && exponent <= _maxPowerOf10)
+            {
+                done = _eiselLemire(significand, exponent, dst);
+            }
+        }
+
+        // Leave the rare remaining cases, such as subnormals, overflow, and long significands, to `from_chars`
+        if (!done)
+        {
+            const std::from_chars_result res{std::from_chars(start, end, dst)};
+
+            // There was an issue parsing
+            if (res.ec != std::errc{})
+            {
+                _setError(ErrorCode::invalidFloater);
+                return false;
+            }
+        }
+
         if (!positive) dst = -dst;
-        _pos = res.ptr;
+        _pos = end;
         return true;
     }
 
@@ -1550,7 +3841,7 @@ namespace qcon
         }
         if (month < 1u || month > 12u)
         {
-            errorMessage = "Invalid month"sv;
+            _setError(ErrorCode::invalidMonth);
             return false;
         }
 
@@ -1567,7 +3858,7 @@ namespace qcon
         }
         if (day < 1u || day > _lastMonthDay(year, month))
         {
-            errorMessage = "Invalid day"sv;
+            _setError(ErrorCode::invalidDay);
             return false;
         }
 
@@ -1591,7 +3882,7 @@ namespace qcon
         if (hour >= 24u)
         {
             _pos -= 2;
-            errorMessage = "Invalid hour"sv;
+            _setError(ErrorCode::invalidHour);
             return false;
         }
 
@@ -1609,7 +3900,7 @@ namespace qcon
         if (minute >= 60u)
         {
             _pos -= 2;
-            errorMessage = "Invalid minute"sv;
+            _setError(ErrorCode::invalidMinute);
             return false;
         }
 
@@ -1627,7 +3918,7 @@ namespace qcon
         if (second >= 60u)
         {
             _pos -= 2;
-            errorMessage = "Invalid second"sv;
+            _setError(ErrorCode::invalidSecond);
             return false;
         }
 
@@ -1686,7 +3977,7 @@ namespace qcon
             if (hour > 23u)
             {
                 _pos -= 2;
-                errorMessage = "Invalid hour"sv;
+                _setError(ErrorCode::invalidHour);
                 return false;
             }
 
@@ -1703,7 +3994,7 @@ namespace qcon
             if (minute > 59u)
             {
                 _pos -= 2;
-                errorMessage = "Invalid minute"sv;
+                _setError(ErrorCode::invalidMinute);
                 return false;
             }
 
@@ -1725,9 +4016,16 @@ namespace qcon
     {
         // Open brace/bracket already consumed
 
-        if (_depth < 64u)
+        if (_depth < maxDepth)
         {
             const bool isObject{container == object};
+
+            // Spill the inline stack once it's full
+            if (_depth && !(_depth & 63u))
+            {
+                _stackSpill.push_back(_stack);
+            }
+
             _stack <<= 1;
             ++_depth;
             _stack |= u64(isObject);
@@ -1736,7 +4034,7 @@ namespace qcon
         }
         else
         {
-            errorMessage = "Exceeded max depth of 64"sv;
+            _setError(ErrorCode::exceededMaxDepth, maxDepth);
             _state = DecodeState::error;
         }
     }
@@ -1747,6 +4045,14 @@ namespace qcon
         ++_pos;
         _stack >>= 1;
         --_depth;
+
+        // Restore the outer levels once the inline stack is empty
+        if (_depth && !(_depth & 63u))
+        {
+            _stack = _stackSpill.back();
+            _stackSpill.pop_back();
+        }
+
         _postValue(DecodeState::end);
     }
 
@@ -1754,14 +4060,8 @@ namespace qcon
     {
         // Already know we have one digit
 
-        if (_isFloater(_pos + 1))
-        {
-            _postValue(_consumeFloater(floater), DecodeState::floater);
-        }
-        else
-        {
-            _postValue(_consumeInteger(integer), DecodeState::integer);
-        }
+        const DecodeState state{_consumeNumber(integer, floater)};
+        _postValue(state != DecodeState::error, state);
     }
 
     inline void Decoder::_ingestValue()
@@ -1772,7 +4072,7 @@ namespace qcon
         {
             case '\0':
             {
-                errorMessage = "Hit end of QCON"sv;
+                _setError(ErrorCode::unexpectedEnd);
                 _state = DecodeState::error;
                 return;
             }
@@ -1791,7 +4091,7 @@ namespace qcon
             case '"':
             {
                 ++_pos;
-                _postValue(_consumeString(string), DecodeState::string);
+                _postValue(_consumeString(string, stringView), DecodeState::string);
                 return;
             }
             case '0': [[fallthrough]];
@@ -1928,7 +4228,929 @@ namespace qcon
             }
         }
 
-        errorMessage = "Unknown value"sv;
+        _setError(ErrorCode::unknownValue);
         _state = DecodeState::error;
     }
+
+    inline bool Decoder::_skipString()
+    {
+        // Already know we have `"`
+        ++_pos;
+
+        while (true)
+        {
+            _pos = _findStringSpecial(_pos);
+
+            if (*_pos == '"')
+            {
+                ++_pos;
+                return true;
+            }
+            else if (*_pos == '\\' && _pos[1])
+            {
+                _pos += 2;
+            }
+            else
+            {
+                _setError(ErrorCode::invalidStringContent);
+                return false;
+            }
+        }
+    }
+
+    inline bool Decoder::_skipValue()
+    {
+        switch (*_pos)
+        {
+            case '\0':
+            {
+                _setError(ErrorCode::unexpectedEnd);
+                return false;
+            }
+            case '{': [[fallthrough]];
+            case '[':
+            {
+                // Only count brackets, jumping over strings and comments, which may contain brackets themselves
+                ++_pos;
+                for (u64 depth{1u}; depth;)
+                {
+                    _pos = _findStructural(_pos);
+
+                    switch (*_pos)
+                    {
+                        case '{': [[fallthrough]];
+                        case '[':
+                        {
+                            ++_pos;
+                            ++depth;
+                            break;
+                        }
+                        case '}': [[fallthrough]];
+                        case ']':
+                        {
+                            ++_pos;
+                            --depth;
+                            break;
+                        }
+                        case '"':
+                        {
+                            if (!_skipString())
+                            {
+                                return false;
+                            }
+                            break;
+                        }
+                        case '#':
+                        {
+                            _pos = _findLineEnd(_pos + 1);
+                            break;
+                        }
+                        default:
+                        {
+                            _setError(ErrorCode::unexpectedEnd);
+                            return false;
+                        }
+                    }
+                }
+
+                return true;
+            }
+            case '"':
+            {
+                // Include any adjacent strings that would be concatenated
+                do
+                {
+                    if (!_skipString())
+                    {
+                        return false;
+                    }
+
+                    _skipSpaceAndComments();
+                } while (*_pos == '"' && (!documentStream || _depth));
+
+                return true;
+            }
+            case ',': [[fallthrough]];
+            case '}': [[fallthrough]];
+            case ']':
+            {
+                _setError(ErrorCode::expectedValue);
+                return false;
+            }
+            default:
+            {
+                // Any other value is a run of characters up to the next space, comment, or structural character
+                while (*_pos && !_isSpace(*_pos) && *_pos != ',' && *_pos != '}' && *_pos != ']' && *_pos != '#')
+                {
+                    ++_pos;
+                }
+
+                return true;
+            }
+        }
+    }
+
+    inline std::vector<const char *> Decoder::_splitRuns(const u64 runLength, const bool documents) const
+    {
+        // The input is indexed a piece at a time to bound memory and to stop at the end of the array
+        static constexpr u64 pieceLength{u64(1u) << 16};
+
+        std::vector<const char *> runStarts{_pos};
+
+        StructuralIndex index{};
+        u64 depth{0u}; // Relative to the array or root
+        bool separated{false}; // Whether a comma past the end of the run was found directly within the array
+
+        // Directly within the array, the first comma past the end of the run ends the run
+        // Likewise at root, the first document past the end of the run starts the next run
+        const auto startsRun{[&](const char * const value)
+        {
+            return documents ? u64(value - runStarts.back()) > runLength : separated;
+        }};
+
+        for (const char * piece{_pos}; ; piece += pieceLength)
+        {
+            u64 length{};
+            if (_end)
+            {
+                length = u64(_end - piece) < pieceLength ? u64(_end - piece) : pieceLength;
+            }
+            else
+            {
+                while (length < pieceLength && piece[length])
+                {
+                    ++length;
+                }
+            }
+
+            if (piece == _pos)
+            {
+                index.build({piece, length});
+            }
+            else
+            {
+                index.buildNext({piece, length});
+            }
+
+            for (const u32 offset : index.offsets())
+            {
+                const char * const c{piece + offset};
+                switch (*c)
+                {
+                    case '}': [[fallthrough]];
+                    case ']':
+                    {
+                        if (!depth)
+                        {
+                            return runStarts;
+                        }
+                        --depth;
+                        break;
+                    }
+                    case ',':
+                    {
+                        separated = separated || (!depth && u64(c - runStarts.back()) >= runLength);
+                        break;
+                    }
+                    case ':':
+                    {
+                        break;
+                    }
+                    default:
+                    {
+                        if (!depth)
+                        {
+                            if (startsRun(c))
+                            {
+                                runStarts.push_back(c);
+                                separated = false;
+                            }
+
+                            // Root strings are separate documents, but the index treats adjacent strings as concatenated
+                            if (documents && *c == '"')
+                            {
+                                for (const char * string{c}; ; )
+                                {
+                                    const char * pos{_findStringSpecial(string + 1)};
+                                    while (*pos != '"')
+                                    {
+                                        if (!*pos)
+                                        {
+                                            return runStarts;
+                                        }
+                                        pos = _findStringSpecial(pos + 1 + (*pos == '\\' && pos[1]));
+                                    }
+
+                                    string = _findNonSpace(pos + 1);
+                                    while (*string == '#')
+                                    {
+                                        string = _findNonSpace(_findLineEnd(string + 1));
+                                    }
+                                    if (*string != '"')
+                                    {
+                                        break;
+                                    }
+
+                                    if (startsRun(string))
+                                    {
+                                        runStarts.push_back(string);
+                                    }
+                                }
+                            }
+                        }
+
+                        if (*c == '{' || *c == '[')
+                        {
+                            ++depth;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            if (length < pieceLength)
+            {
+                return runStarts;
+            }
+        }
+    }
+
+    inline PushDecoder::PushDecoder()
+    {
+        _state = DecodeState::ready;
+    }
+
+    inline void PushDecoder::feed(const std::string_view chunk)
+    {
+        // Preserve error state
+        if (_state == DecodeState::error)
+        {
+            return;
+        }
+
+        if (_closed)
+        {
+            _setError(ErrorCode::inputAlreadyClosed);
+            _state = DecodeState::error;
+            return;
+        }
+
+        // Restore the character displaced by the cut
+        if (_cut)
+        {
+            _input[_cut] = _cutChar;
+        }
+
+        // Discard consumed input
+        if (_loaded)
+        {
+            const u64 consumed{u64(_pos - _input.data())};
+            _input.erase(_input.begin(), _input.begin() + s64(consumed));
+            _scanned -= consumed;
+            _cut -= consumed;
+            _discarded += consumed;
+        }
+
+        _input.insert(_input.end(), chunk.begin(), chunk.end());
+
+        // Input may have been reallocated
+        if (_loaded)
+        {
+            _qcon = _input.data();
+            _pos = _qcon;
+        }
+
+        _scan();
+    }
+
+    inline void PushDecoder::close()
+    {
+        if (_closed || _state == DecodeState::error)
+        {
+            return;
+        }
+
+        // Restore the character displaced by the cut, then terminate for real
+        if (_cut)
+        {
+            _input[_cut] = _cutChar;
+        }
+
+        const u64 consumed{_loaded ? u64(_pos - _input.data()) : 0u};
+        _input.push_back('\0');
+        _closed = true;
+        _cut = _input.size() - 1u;
+
+        if (_loaded)
+        {
+            _qcon = _input.data();
+            _pos = _qcon + consumed;
+        }
+        else
+        {
+            Decoder::load(_input.data());
+            _loaded = true;
+        }
+
+        // An early null character must not be mistaken for the end
+        _end = _input.data() + _cut;
+    }
+
+    inline bool PushDecoder::available()
+    {
+        if (_state == DecodeState::error)
+        {
+            return false;
+        }
+
+        if (_closed)
+        {
+            return !finished();
+        }
+
+        return _loaded && _pos < _input.data() + _cut;
+    }
+
+    inline DecodeState PushDecoder::step()
+    {
+        if (!available())
+        {
+            if (_state != DecodeState::error)
+            {
+                _setError(ErrorCode::insufficientInput);
+                _state = DecodeState::error;
+            }
+
+            return _state;
+        }
+
+        return Decoder::step();
+    }
+
+    inline void PushDecoder::_scan()
+    {
+        // The decoder moves from one unit to the next after each `[`, `{`, `,`, or key `:`, and any space or comments
+        //   that follow; a unit is therefore complete once the next significant character after such a boundary has
+        //   been seen, and the cut is placed just before it
+        const u64 size{_input.size()};
+        u64 cut{0u};
+
+        for (u64 i{_scanned}; i < size; ++i)
+        {
+            const char c{_input[i]};
+
+            switch (_lexeme)
+            {
+                case _Lexeme::space:
+                {
+                    if (_isSpace(c))
+                    {
+                        break;
+                    }
+
+                    if (c == '#')
+                    {
+                        _lexeme = _Lexeme::comment;
+                        break;
+                    }
+
+                    if (_boundaryPending)
+                    {
+                        cut = i;
+                        _boundaryPending = false;
+                    }
+
+                    if (c == '"')
+                    {
+                        _lexeme = _Lexeme::string;
+                    }
+                    else
+                    {
+                        // A `:` is only a boundary after a key, as it also appears in times
+                        _boundaryPending = c == '[' || c == '{' || c == ',' || (c == ':' && _lastSignificant == '"');
+                    }
+
+                    _lastSignificant = c;
+                    break;
+                }
+                case _Lexeme::string:
+                {
+                    if (c == '"')
+                    {
+                        _lexeme = _Lexeme::space;
+                    }
+                    else if (c == '\\')
+                    {
+                        _lexeme = _Lexeme::escape;
+                    }
+
+                    break;
+                }
+                case _Lexeme::escape:
+                {
+                    _lexeme = _Lexeme::string;
+                    break;
+                }
+                case _Lexeme::comment:
+                {
+                    if (c == '\n')
+                    {
+                        _lexeme = _Lexeme::space;
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        _scanned = size;
+
+        if (cut)
+        {
+            _setCut(cut);
+        }
+        else if (_cut)
+        {
+            // Keep the previous cut
+            _cutChar = _input[_cut];
+            _input[_cut] = '\0';
+        }
+    }
+
+    inline void PushDecoder::_setCut(const u64 cut)
+    {
+        _cut = cut;
+        _cutChar = _input[_cut];
+        _input[_cut] = '\0';
+
+        if (!_loaded)
+        {
+            Decoder::load(_input.data());
+            _loaded = true;
+        }
+    }
+
+    inline StructuralIndex::StructuralIndex(const std::string_view qcon)
+    {
+        build(qcon);
+    }
+
+    inline bool StructuralIndex::build(const std::string_view qcon)
+    {
+        _inString = false;
+        _inComment = false;
+        _escapeCarry = false;
+        _afterString = false;
+        _scalarCarry = 0u;
+        _plainScalarCarry = 0u;
+
+        return buildNext(qcon);
+    }
+
+    inline bool StructuralIndex::buildNext(const std::string_view qcon)
+    {
+        _offsets.clear();
+
+        if (qcon.size() > std::numeric_limits<u32>::max())
+        {
+            return false;
+        }
+
+        u64 count{0u};
+
+        for (u64 blockStart{0u}; blockStart < qcon.size(); blockStart += 64u)
+        {
+            const u64 blockLength{qcon.size() - blockStart < 64u ? qcon.size() - blockStart : 64u};
+            const u64 valid{blockLength == 64u ? ~u64(0u) : (u64(1u) << blockLength) - 1u};
+
+            // The final partial block is copied so loads stay within bounds
+            alignas(64) char padded[64];
+            const char * block{qcon.data() + blockStart};
+            if (blockLength < 64u)
+            {
+                std::memcpy(padded, block, blockLength);
+                std::memset(padded + blockLength, 0, 64u - blockLength);
+                block = padded;
+            }
+
+            const _BlockMasks masks{_classifyBlock(block)};
+
+            // Find escaped characters; backslashes are rare, so handle them one at a time
+            u64 escaped{0u};
+            u64 backslashes{masks.backslash};
+            if (_escapeCarry)
+            {
+                escaped = 1u;
+                backslashes &= ~u64(1u);
+            }
+            _escapeCarry = false;
+            while (backslashes)
+            {
+                const u64 i{u64(std::countr_zero(backslashes))};
+                if (i == 63u)
+                {
+                    _escapeCarry = true;
+                    break;
+                }
+                escaped |= u64(2u) << i;
+                backslashes &= ~(u64(3u) << i);
+            }
+            const u64 quotes{masks.quote & ~escaped};
+
+            // Resolve strings and comments in order, as quotes within comments and `#` within strings are inert
+            // Strings include their opening quote but not their closing quote; comments exclude their ending newline
+            u64 strings{0u};
+            u64 comments{0u};
+            u64 from{0u};
+            if (_inComment)
+            {
+                if (masks.newline)
+                {
+                    from = u64(std::countr_zero(masks.newline));
+                    comments = (u64(1u) << from) - 1u;
+                    _inComment = false;
+                }
+                else
+                {
+                    comments = ~u64(0u);
+                    from = 64u;
+                }
+            }
+            while (from < 64u)
+            {
+                const u64 live{~u64(0u) << from};
+                const u64 inside{(_prefixXor(quotes & live) ^ (_inString ? ~u64(0u) : u64(0u))) & live};
+                const u64 hashes{masks.hash & ~inside & live};
+                if (!hashes)
+                {
+                    strings |= inside;
+                    _inString = inside >> 63;
+                    break;
+                }
+
+                const u64 hash{u64(std::countr_zero(hashes))};
+                strings |= inside & ((u64(1u) << hash) - 1u);
+                _inString = false;
+
+                const u64 newlines{masks.newline & (~u64(0u) << hash)};
+                if (!newlines)
+                {
+                    comments |= ~u64(0u) << hash;
+                    _inComment = true;
+                    break;
+                }
+
+                from = u64(std::countr_zero(newlines));
+                comments |= (~u64(0u) << hash) & ((u64(1u) << from) - 1u);
+            }
+
+            const u64 outside{~(strings | comments) & valid};
+            const u64 openQuotes{quotes & strings & valid};
+            const u64 closeQuotes{quotes & outside};
+
+            // Colons directly following a scalar character belong to the scalar, as in times and timezones
+            const u64 plainScalars{~(masks.space | masks.structural | quotes) & outside};
+            const u64 scalarColons{masks.colon & outside & ((plainScalars << 1) | _plainScalarCarry)};
+            const u64 scalars{plainScalars | scalarColons};
+            const u64 scalarStarts{scalars & ~((scalars << 1) | _scalarCarry)};
+            _plainScalarCarry = plainScalars >> 63;
+            _scalarCarry = scalars >> 63;
+
+            // A string is concatenated onto the one before it if the previous significant character is a closing quote
+            // Adding a bit just after each closing quote to the gaps between significant characters carries it to the
+            //   next significant character
+            const u64 significant{(masks.structural & outside & ~scalarColons) | openQuotes | closeQuotes | scalarStarts};
+            const u64 afterCloseQuotes{(~significant + (closeQuotes << 1) + u64(_afterString)) & significant};
+            if (significant)
+            {
+                _afterString = (closeQuotes >> (63 - std::countl_zero(significant))) & 1u;
+            }
+
+            // Extract offsets, which never outnumber the characters in the block
+            if (_offsets.size() - count < 64u)
+            {
+                _offsets.resize(_offsets.size() * 2u + 64u);
+            }
+            u64 bits{significant & ~closeQuotes & ~(openQuotes & afterCloseQuotes)};
+            while (bits)
+            {
+                _offsets[count++] = u32(blockStart + u64(std::countr_zero(bits)));
+                bits &= bits - 1u;
+            }
+        }
+
+        _offsets.resize(count);
+
+        return true;
+    }
+
+    inline OnDemandValue::OnDemandValue(OnDemand * const doc, const char * const pos) :
+        _doc{doc},
+        _pos{pos}
+    {}
+
+    inline OnDemandValue OnDemandValue::operator[](const std::string_view key) const
+    {
+        return OnDemandValue{_doc, _pos ? _doc->_findMember(_pos, key) : nullptr};
+    }
+
+    inline OnDemandValue OnDemandValue::operator[](const u64 i) const
+    {
+        return OnDemandValue{_doc, _pos ? _doc->_findElement(_pos, i) : nullptr};
+    }
+
+    template <typename T>
+    inline std::optional<T> OnDemandValue::get() const
+    {
+        return _pos ? _doc->_get<T>(_pos) : std::nullopt;
+    }
+
+    inline OnDemand::OnDemand()
+    {
+        zeroCopy = true;
+    }
+
+    inline OnDemand::OnDemand(const char * const qcon) :
+        Decoder{qcon}
+    {
+        zeroCopy = true;
+    }
+
+    inline OnDemand::OnDemand(const char * const qcon, const u64 length, const bool padded) :
+        Decoder{qcon, length, padded}
+    {
+        zeroCopy = true;
+    }
+
+    inline OnDemandValue OnDemand::root()
+    {
+        // Loading leaves the position at the root value, but it may since have moved
+        if (!_qcon)
+        {
+            return OnDemandValue{this, nullptr};
+        }
+
+        _pos = _qcon;
+        _skipSpaceAndComments();
+
+        if (!*_pos)
+        {
+            _setError(ErrorCode::expectedValue);
+            return OnDemandValue{this, nullptr};
+        }
+
+        return OnDemandValue{this, _pos};
+    }
+
+    inline bool OnDemand::_skipSeparator(const char closer)
+    {
+        _skipSpaceAndComments();
+
+        if (_tryConsumeChar(','))
+        {
+            _skipSpaceAndComments();
+            return true;
+        }
+
+        if (*_pos == closer)
+        {
+            return true;
+        }
+
+        _setError(ErrorCode::expectedComma);
+        return false;
+    }
+
+    inline const char * OnDemand::_findMember(const char * const pos, const std::string_view name)
+    {
+        if (*pos != '{')
+        {
+            _setError(ErrorCode::expectedObject);
+            return nullptr;
+        }
+
+        _pos = pos + 1;
+        _skipSpaceAndComments();
+
+        while (*_pos != '}')
+        {
+            if (!_consumeKey(key, keyView))
+            {
+                return nullptr;
+            }
+
+            _skipSpaceAndComments();
+
+            if (keyView == name)
+            {
+                return _pos;
+            }
+
+            if (!_skipValue() || !_skipSeparator('}'))
+            {
+                return nullptr;
+            }
+        }
+
+        _setError(ErrorCode::missingKey);
+        return nullptr;
+    }
+
+    inline const char * OnDemand::_findElement(const char * const pos, u64 i)
+    {
+        if (*pos != '[')
+        {
+            _setError(ErrorCode::expectedArray);
+            return nullptr;
+        }
+
+        _pos = pos + 1;
+        _skipSpaceAndComments();
+
+        for (; *_pos != ']'; --i)
+        {
+            if (!i)
+            {
+                return _pos;
+            }
+
+            if (!_skipValue() || !_skipSeparator(']'))
+            {
+                return nullptr;
+            }
+        }
+
+        _setError(ErrorCode::indexOutOfRange);
+        return nullptr;
+    }
+
+    template <typename T>
+    inline std::optional<T> OnDemand::_get(const char * const pos)
+    {
+        // Decode as the first element of an array, which needs no preceding comma and ignores what follows
+        _state = DecodeState::array;
+        _pos = pos;
+        _stack = 0u;
+        _depth = 1u;
+        _hadComma = false;
+
+        T v{};
+        static_cast<Decoder &>(*this) >> v;
+
+        if (_state == DecodeState::error)
+        {
+            return {};
+        }
+
+        return v;
+    }
+
+    [[nodiscard]] inline constexpr u64 _bindingSlot(const std::string_view key, const u64 seed, const u64 mask)
+    {
+        // FNV-1a
+        u64 hash{0xCBF29CE484222325u ^ seed};
+        for (const char c : key)
+        {
+            hash = (hash ^ u8(c)) * 0x100000001B3u;
+        }
+
+        return (hash ^ (hash >> 32u)) & mask;
+    }
+
+    template <typename M> inline void _decodeMember(Decoder & decoder, M & v)
+    {
+        if constexpr (_private::isVector<M>)
+        {
+            v.clear();
+            if (decoder >> array)
+            {
+                while (decoder.more())
+                {
+                    _decodeMember(decoder, v.emplace_back());
+                }
+            }
+        }
+        else if constexpr (std::is_same_v<M, std::chrono::year_month_day>)
+        {
+            Date date;
+            if (decoder >> date)
+            {
+                v = date.toYmd();
+            }
+        }
+        else if constexpr (_private::isDuration<M>)
+        {
+            Time time;
+            if (decoder >> time)
+            {
+                v = std::chrono::duration_cast<M>(time.toDuration());
+            }
+        }
+        else
+        {
+            decoder >> v;
+        }
+    }
+
+    template <typename T> struct _BindingTable
+    {
+        using Fields = std::remove_cvref_t<decltype(Binding<T>::fields)>;
+        using FieldDecoder = void (*)(Decoder &, T &);
+
+        static constexpr u64 count{std::tuple_size_v<Fields>};
+
+        // At least four slots per key makes a perfect hash quick to find
+        static constexpr u64 mask{std::bit_ceil(count * 4u + 1u) - 1u};
+
+        static constexpr std::array<std::string_view, count> keys{[]<u64... i>(std::index_sequence<i...>)
+        {
+            return std::array<std::string_view, count>{std::get<i>(Binding<T>::fields).key...};
+        }(std::make_index_sequence<count>{})};
+
+        static constexpr std::array<FieldDecoder, count> decoders{[]<u64... i>(std::index_sequence<i...>)
+        {
+            return std::array<FieldDecoder, count>{[](Decoder & decoder, T & v)
+            {
+                _decodeMember(decoder, v.*std::get<i>(Binding<T>::fields).member);
+            }...};
+        }(std::make_index_sequence<count>{})};
+
+        static constexpr bool unique{[]
+        {
+            for (u64 i{0u}; i < count; ++i)
+            {
+                for (u64 j{i + 1u}; j < count; ++j)
+                {
+                    if (keys[i] == keys[j])
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }()};
+        static_assert(unique, "Binding keys must be unique");
+
+        static constexpr u64 seed{[]
+        {
+            for (u64 seed{0u}; unique; ++seed)
+            {
+                bool collision{false};
+                for (u64 i{0u}; i < count && !collision; ++i)
+                {
+                    for (u64 j{i + 1u}; j < count && !collision; ++j)
+                    {
+                        collision = _bindingSlot(keys[i], seed, mask) == _bindingSlot(keys[j], seed, mask);
+                    }
+                }
+
+                if (!collision)
+                {
+                    return seed;
+                }
+            }
+
+            return u64(0u);
+        }()};
+
+        // Index of each slot's field plus one, or zero if empty
+        static constexpr std::array<u32, mask + 1u> slots{[]
+        {
+            std::array<u32, mask + 1u> slots{};
+            for (u64 i{0u}; i < count; ++i)
+            {
+                slots[_bindingSlot(keys[i], seed, mask)] = u32(i + 1u);
+            }
+            return slots;
+        }()};
+    };
+
+    template <Bound T> inline Decoder & operator>>(Decoder & decoder, T & v)
+    {
+        using Table = _BindingTable<T>;
+
+        decoder >> object;
+
+        std::string_view key;
+        while (decoder.more())
+        {
+            if (!(decoder >> key))
+            {
+                break;
+            }
+
+            const u32 slot{Table::slots[_bindingSlot(key, Table::seed, Table::mask)]};
+            if (slot && Table::keys[slot - 1u] == key)
+            {
+                Table::decoders[slot - 1u](decoder, v);
+            }
+            else
+            {
+                decoder.skip();
+            }
+        }
+
+        return decoder;
+    }
 }
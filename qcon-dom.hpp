@@ -8,12 +8,20 @@
 /// See the README for more info
 ///
 
-#include <map>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <qcon-decode.hpp>
 #include <qcon-encode.hpp>
@@ -23,7 +31,7 @@ namespace qcon
     ///
     /// The type of the QCON value
     ///
-    enum class Type
+    enum class Type : u8
     {
         null,
         object,
@@ -39,10 +47,141 @@ namespace qcon
 
     class Value;
 
-    // TODO: Use something more efficient
-    using Object = std::map<std::string, Value>;
+    ///
+    /// Maps keys to QCON values
+    /// The elements are stored contiguously in insertion order, so decoded objects encode in their original order, with
+    ///   the hash of each key stored alongside
+    /// Small objects are searched linearly by hash; larger objects additionally build a compact hash index
+    /// Lookups take a `std::string_view`, so never allocate
+    /// Follows the interface of `std::map`, except for the order of elements, and that insertion and erasure invalidate
+    ///   iterators and references
+    ///
+    class Object
+    {
+      public:
+
+        using key_type = std::string;
+        using mapped_type = Value;
+        using value_type = std::pair<std::string, Value>;
+        using size_type = u64;
+        using iterator = std::pmr::vector<value_type>::iterator;
+        using const_iterator = std::pmr::vector<value_type>::const_iterator;
+
+        Object() = default;
+
+        ///
+        /// Constructs empty, with all storage allocated from the given memory resource, which must outlive the object
+        /// @param resource memory resource from which to allocate
+        ///
+        explicit Object(std::pmr::memory_resource & resource);
+
+        ///
+        /// Constructs from the given elements, keeping their order
+        /// Of elements with the same key, only the first is kept
+        /// @param elements elements to take
+        ///
+        explicit Object(std::vector<value_type> && elements);
+
+        Object(const Object &) = delete;
+        Object(Object && other) = default;
+
+        Object & operator=(const Object &) = delete;
+        Object & operator=(Object && other) = default;
+
+        ~Object() = default;
+
+        [[nodiscard]] iterator begin() { return _elements.begin(); }
+        [[nodiscard]] const_iterator begin() const { return _elements.begin(); }
+        [[nodiscard]] const_iterator cbegin() const { return _elements.cbegin(); }
+
+        [[nodiscard]] iterator end() { return _elements.end(); }
+        [[nodiscard]] const_iterator end() const { return _elements.end(); }
+        [[nodiscard]] const_iterator cend() const { return _elements.cend(); }
+
+        [[nodiscard]] bool empty() const { return _elements.empty(); }
+
+        [[nodiscard]] size_type size() const { return _elements.size(); }
+
+        void clear();
+
+        void reserve(size_type capacity);
+
+        ///
+        /// @return iterator to the element with the given key, or `end()` if there is none
+        ///
+        [[nodiscard]] iterator find(std::string_view key);
+        [[nodiscard]] const_iterator find(std::string_view key) const;
+
+        [[nodiscard]] bool contains(std::string_view key) const;
+
+        [[nodiscard]] size_type count(std::string_view key) const;
+
+        ///
+        /// @return value of the element with the given key
+        /// @throw std::out_of_range if there is no element with the given key
+        ///
+        [[nodiscard]] Value & at(std::string_view key);
+        [[nodiscard]] const Value & at(std::string_view key) const;
+
+        ///
+        /// @return value of the element with the given key, which is first inserted as null if there is none
+        ///
+        Value & operator[](std::string_view key);
+        Value & operator[](key_type && key);
+        Value & operator[](const char * key) { return (*this)[std::string_view{key}]; }
 
-    using Array = std::vector<Value>;
+        ///
+        /// Inserts an element constructed from the given key and value arguments if there is none with the key
+        /// @return iterator to the element with the key, and whether it was inserted
+        ///
+        template <typename K, typename... Args> std::pair<iterator, bool> emplace(K && key, Args &&... args);
+
+        std::pair<iterator, bool> insert(value_type && element);
+
+        ///
+        /// Erases the element at the given position
+        /// @return iterator to the following element
+        ///
+        iterator erase(const_iterator pos);
+
+        ///
+        /// Erases the element with the given key, if there is one
+        /// @return number of elements erased
+        ///
+        size_type erase(std::string_view key);
+
+        ///
+        /// @return whether both objects have equal elements, regardless of order
+        ///
+        [[nodiscard]] bool operator==(const Object & other) const;
+
+      private:
+
+        // Objects of up to this size are searched linearly, without an index
+        static constexpr u64 _linearSearchMax{16u};
+
+        std::pmr::vector<value_type> _elements{};
+        std::pmr::vector<u32> _hashes{};
+        std::pmr::vector<u32> _index{}; // Open addressed; each slot is an element's position plus one, or zero if empty
+
+        [[nodiscard]] static u32 _hash(std::string_view key);
+
+        [[nodiscard]] u64 _find(std::string_view key, u32 hash) const;
+
+        std::pair<iterator, bool> _insert(value_type && element);
+
+        void _indexElement(u64 i);
+
+        void _reindex();
+    };
+
+    using Array = std::pmr::vector<Value>;
+
+    namespace _private
+    {
+        // Creates a value whose underlying object, array, long string, or datetime is allocated from the arena, if given
+        template <typename T> [[nodiscard]] Value arenaValue(std::pmr::memory_resource * arena, T && v);
+    }
 
     ///
     /// Represents a QCON value
@@ -137,10 +276,10 @@ namespace qcon
         [[nodiscard]] const Array * array() const;
 
         ///
-        /// @return this value as a string if it is a string, otherwise null
+        /// Short strings are stored inline rather than as a `std::string`, so are only exposed as a view
+        /// @return this value as a string if it is a string, otherwise empty
         ///
-        [[nodiscard]] std::string * string();
-        [[nodiscard]] const std::string * string() const;
+        [[nodiscard]] std::optional<std::string_view> string() const;
 
         ///
         /// @return this value as an integer if it is an integer, otherwise null
@@ -184,6 +323,20 @@ namespace qcon
         [[nodiscard]] nullptr_t * null();
         [[nodiscard]] const nullptr_t * null() const;
 
+        ///
+        /// @param key key of the member to find
+        /// @return value of the member with the given key if this is an object and it has one, otherwise null
+        ///
+        [[nodiscard]] Value * find(std::string_view key);
+        [[nodiscard]] const Value * find(std::string_view key) const;
+
+        ///
+        /// Unlike `Object::operator[]`, never inserts, so lookups can be chained through missing members
+        /// @param key key of the member to find
+        /// @return value of the member with the given key if this is an object and it has one, otherwise a null value
+        ///
+        [[nodiscard]] const Value & operator[](std::string_view key) const;
+
         ///
         /// @return whether the number was positive; useful for unsigned integers too large to fit in a s64
         ///
@@ -229,17 +382,37 @@ namespace qcon
             s64 _integer;
             f64 _floater;
             bool _boolean;
+            Date _date;
+            Time _time;
             Datetime * _datetime;
             nullptr_t _null;
         };
+        char _shortTail[4]; // Short strings start in the union and continue into these bytes
+        u8 _shortSize{}; // Size of an inline string, or `_longString` if the string is on the heap
         Type _type{};
         bool _positive{};
+        bool _arena{}; // Whether the underlying value was allocated from an arena, and so must not be freed
+
+        // Strings up to this size are stored inline
+        static constexpr u64 _shortStringMax{12u};
+        static constexpr u8 _longString{0xFFu};
+
+        [[nodiscard]] char * _shortChars() { return reinterpret_cast<char *>(this); }
+        [[nodiscard]] const char * _shortChars() const { return reinterpret_cast<const char *>(this); }
+
+        void _setString(std::string_view v);
+
+        void _setString(std::string && v);
 
         void _deleteValue();
+
+        template <typename T> friend Value _private::arenaValue(std::pmr::memory_resource * arena, T && v);
     };
 
     /// `Value` is small, allowing for efficient container storage
     static_assert(sizeof(Value) == 16u);
+    static_assert(sizeof(Date) <= 8u && sizeof(Time) <= 8u, "Dates and times must fit inline");
+    static_assert(std::is_standard_layout_v<Value>, "Inline strings rely on the layout of `Value`; see `_setString`");
 
     ///
     /// Creates an object by forward-constructing from the given key value pairs
@@ -267,7 +440,66 @@ namespace qcon
     [[nodiscard]] std::optional<Value> decode(const char * qcon);
     [[nodiscard]] std::optional<Value> decode(const std::string & qcon) { return decode(qcon.c_str()); }
     [[nodiscard]] std::optional<Value> decode(std::string &&) = delete; /// Prevent binding to temporary
-    [[nodiscard]] std::optional<Value> decode(std::string_view) = delete; /// QCON string must be null terminated, pass c-string instead
+
+    ///
+    /// Decodes the given bounded QCON string
+    /// See `Decoder::load` for the meaning of `padded`
+    /// @param qcon QCON string to decode; need not be null terminated
+    /// @param length number of characters in the QCON
+    /// @param padded whether `qcon[length]` is readable
+    /// @return decoded value of the QCON, or empty if the string is invalid or could otherwise not be decoded
+    ///
+    [[nodiscard]] std::optional<Value> decode(const char * qcon, u64 length, bool padded = false);
+    [[nodiscard]] std::optional<Value> decode(std::string_view qcon) { return decode(qcon.data(), qcon.size()); }
+
+    ///
+    /// Decodes the given QCON file, which is memory mapped rather than read into memory
+    /// @param path path of the QCON file to decode
+    /// @return decoded value of the QCON, or empty if the file could not be opened or is invalid
+    ///
+    [[nodiscard]] std::optional<Value> decodeFile(const std::filesystem::path & path);
+
+    ///
+    /// Decodes the given QCON string exactly like `decode`, except that if the root is an array, its elements are split
+    ///   into runs that are decoded concurrently on separate threads
+    /// The runs are found by first scanning for the structure of the array, which is much faster than decoding it
+    /// @param qcon QCON string to decode; see the corresponding `decode` overloads
+    /// @param threads maximum number of threads to use, including the calling thread; zero uses one per hardware thread
+    /// @return decoded value of the QCON, or empty if the string is invalid or could otherwise not be decoded
+    ///
+    [[nodiscard]] std::optional<Value> decodeParallel(const char * qcon, u64 threads = 0u);
+    [[nodiscard]] std::optional<Value> decodeParallel(const std::string & qcon, u64 threads = 0u);
+    [[nodiscard]] std::optional<Value> decodeParallel(std::string &&, u64 = 0u) = delete; /// Prevent binding to temporary
+    [[nodiscard]] std::optional<Value> decodeParallel(std::string_view qcon, u64 threads = 0u);
+
+    ///
+    /// Decodes the given QCON file exactly like `decodeFile`, but in parallel like `decodeParallel`
+    /// @param path path of the QCON file to decode
+    /// @param threads maximum number of threads to use, including the calling thread; zero uses one per hardware thread
+    /// @return decoded value of the QCON, or empty if the file could not be opened or is invalid
+    ///
+    [[nodiscard]] std::optional<Value> decodeFileParallel(const std::filesystem::path & path, u64 threads = 0u);
+
+    ///
+    /// Decodes the given QCON document stream, such as newline-delimited logs, into each of its root values
+    /// See `Decoder::documentStream`
+    /// With multiple threads, the documents are split into runs that are decoded concurrently, like `decodeParallel`
+    /// @param qcon QCON string to decode; see the corresponding `decode` overloads
+    /// @param threads maximum number of threads to use, including the calling thread; zero uses one per hardware thread
+    /// @return decoded value of each document in order, or empty if any document is invalid
+    ///
+    [[nodiscard]] std::optional<std::vector<Value>> decodeDocuments(const char * qcon, u64 threads = 1u);
+    [[nodiscard]] std::optional<std::vector<Value>> decodeDocuments(const std::string & qcon, u64 threads = 1u);
+    [[nodiscard]] std::optional<std::vector<Value>> decodeDocuments(std::string &&, u64 = 1u) = delete; /// Prevent binding to temporary
+    [[nodiscard]] std::optional<std::vector<Value>> decodeDocuments(std::string_view qcon, u64 threads = 1u);
+
+    ///
+    /// Decodes the given QCON document stream file exactly like `decodeDocuments`
+    /// @param path path of the QCON file to decode
+    /// @param threads maximum number of threads to use, including the calling thread; zero uses one per hardware thread
+    /// @return decoded value of each document in order, or empty if the file could not be opened or is invalid
+    ///
+    [[nodiscard]] std::optional<std::vector<Value>> decodeFileDocuments(const std::filesystem::path & path, u64 threads = 1u);
 
     ///
     /// Encodes the QCON value into a QCON string
@@ -277,6 +509,311 @@ namespace qcon
     /// @return encoded QCON string, or empty if there was an issue encoding the QCON
     ///
     [[nodiscard]] std::optional<std::string> encode(const Value & v, Density density = Encoder::defaultDensity, std::string_view indentStr = Encoder::defaultIndentString);
+
+    class Document;
+
+    namespace _private
+    {
+        std::optional<Document> decodeArenaRoot(Decoder & decoder);
+    }
+
+    ///
+    /// A QCON value along with a monotonic arena from which its objects, arrays, strings, and datetimes, and the storage
+    ///   of its containers, are allocated
+    /// Nothing is freed individually, so decoding and destruction avoid nearly all heap traffic; only strings too long
+    ///   for `std::string`'s small buffer still use the heap
+    /// The root may be modified like any other value, but values moved out of it must not outlive the document
+    ///
+    class Document
+    {
+      public:
+
+        Document(const Document &) = delete;
+        Document(Document && other) = default;
+
+        Document & operator=(const Document &) = delete;
+        Document & operator=(Document && other);
+
+        ~Document() = default;
+
+        ///
+        /// @return the root value
+        ///
+        [[nodiscard]] Value & root() { return _root; }
+        [[nodiscard]] const Value & root() const { return _root; }
+
+      private:
+
+        // Enough for a typical small document in one block
+        static constexpr u64 _initialArenaSize{4096u};
+
+        // Declared first so the root is destroyed before it
+        std::unique_ptr<std::pmr::monotonic_buffer_resource> _arena{};
+        Value _root{};
+
+        Document();
+
+        friend std::optional<Document> _private::decodeArenaRoot(Decoder & decoder);
+    };
+
+    ///
+    /// Decodes the given QCON string into an arena-backed document
+    /// The QSON string *must* be null terminated (optimization allowing most range checks to be eliminated)
+    /// @param qcon QCON string to decode
+    /// @return decoded document of the QCON, or empty if the string is invalid or could otherwise not be decoded
+    ///
+    [[nodiscard]] std::optional<Document> decodeArena(const char * qcon);
+    [[nodiscard]] std::optional<Document> decodeArena(const std::string & qcon) { return decodeArena(qcon.c_str()); }
+    [[nodiscard]] std::optional<Document> decodeArena(std::string &&) = delete; /// Prevent binding to temporary
+
+    ///
+    /// Decodes the given bounded QCON string into an arena-backed document
+    /// See `Decoder::load` for the meaning of `padded`
+    /// @param qcon QCON string to decode; need not be null terminated
+    /// @param length number of characters in the QCON
+    /// @param padded whether `qcon[length]` is readable
+    /// @return decoded document of the QCON, or empty if the string is invalid or could otherwise not be decoded
+    ///
+    [[nodiscard]] std::optional<Document> decodeArena(const char * qcon, u64 length, bool padded = false);
+    [[nodiscard]] std::optional<Document> decodeArena(std::string_view qcon) { return decodeArena(qcon.data(), qcon.size()); }
+
+    ///
+    /// Decodes the given QCON file into an arena-backed document, which is memory mapped rather than read into memory
+    /// @param path path of the QCON file to decode
+    /// @return decoded document of the QCON, or empty if the file could not be opened or is invalid
+    ///
+    [[nodiscard]] std::optional<Document> decodeArenaFile(const std::filesystem::path & path);
+
+    class Tape;
+
+    ///
+    /// Read-only reference to a value within a `Tape`
+    /// Cheap to copy, and only valid for as long as its tape
+    ///
+    class TapeValue
+    {
+      public:
+
+        ///
+        /// Iterates the elements of an array or the members of an object
+        ///
+        class Iterator
+        {
+          public:
+
+            ///
+            /// @return the current element, or the value of the current member
+            ///
+            [[nodiscard]] TapeValue operator*() const;
+
+            ///
+            /// @return the key of the current member; must be iterating an object
+            ///
+            [[nodiscard]] std::string_view key() const;
+
+            Iterator & operator++();
+
+            [[nodiscard]] bool operator==(const Iterator &) const = default;
+
+          private:
+
+            const Tape * _tape{};
+            u64 _index{}; // Index of the current element, or of the current member's key
+
+            Iterator(const Tape * tape, u64 index);
+
+            friend TapeValue;
+        };
+
+        ///
+        /// @return type of the value
+        ///
+        [[nodiscard]] Type type() const;
+
+        ///
+        /// @return number of elements if an array, number of members if an object, otherwise zero
+        ///
+        [[nodiscard]] u64 size() const;
+
+        ///
+        /// @return iterators over the elements of an array or the members of an object; empty for other types
+        ///
+        [[nodiscard]] Iterator begin() const;
+        [[nodiscard]] Iterator end() const;
+
+        ///
+        /// Jumps over the preceding members without visiting their contents
+        /// @param key key of the member to find
+        /// @return value of the member with the given key if this is an object and it exists, otherwise empty
+        ///
+        [[nodiscard]] std::optional<TapeValue> find(std::string_view key) const;
+
+        ///
+        /// Jumps over the preceding elements without visiting their contents
+        /// @param i index of the element to find
+        /// @return the element at the given index if this is an array and it is in range, otherwise empty
+        ///
+        [[nodiscard]] std::optional<TapeValue> element(u64 i) const;
+
+        ///
+        /// @return this value as a string if it is a string, otherwise empty
+        ///
+        [[nodiscard]] std::optional<std::string_view> string() const;
+
+        ///
+        /// @return this value as an integer if it is an integer, otherwise empty
+        ///
+        [[nodiscard]] std::optional<s64> integer() const;
+
+        ///
+        /// @return this value as a floater if it is a floater, otherwise empty
+        ///
+        [[nodiscard]] std::optional<f64> floater() const;
+
+        ///
+        /// @return this value as a boolean if it is a boolean, otherwise empty
+        ///
+        [[nodiscard]] std::optional<bool> boolean() const;
+
+        ///
+        /// @return this value as a date if it is a date or datetime, otherwise empty
+        ///
+        [[nodiscard]] std::optional<Date> date() const;
+
+        ///
+        /// @return this value as a time if it is a time or datetime, otherwise empty
+        ///
+        [[nodiscard]] std::optional<Time> time() const;
+
+        ///
+        /// @return this value as a datetime if it is a datetime, otherwise empty
+        ///
+        [[nodiscard]] std::optional<Datetime> datetime() const;
+
+        ///
+        /// @return whether this value is null
+        ///
+        [[nodiscard]] bool null() const;
+
+        ///
+        /// @return whether the number was positive; useful for unsigned integers too large to fit in a s64
+        ///
+        [[nodiscard]] bool positive() const;
+
+      private:
+
+        const Tape * _tape{};
+        u64 _index{};
+
+        TapeValue(const Tape * tape, u64 index);
+
+        friend Tape;
+    };
+
+    namespace _private
+    {
+        std::optional<Tape> decodeTapeRoot(Decoder & decoder);
+    }
+
+    ///
+    /// Compact read-only alternative to `Value`, decoded in a single pass
+    /// Values are stored in a flat array of typed 64 bit entries with all strings in one contiguous buffer
+    /// Containers record the index of their end, so they can be jumped over without visiting their contents
+    ///
+    class Tape
+    {
+      public:
+
+        ///
+        /// @return the root value
+        ///
+        [[nodiscard]] TapeValue root() const { return TapeValue{this, 0u}; }
+
+        ///
+        /// @return number of bytes used to store the document
+        ///
+        [[nodiscard]] u64 footprint() const { return _entries.size() * sizeof(u64) + _strings.size(); }
+
+      private:
+
+        // The top byte of an entry is its tag, and the rest is its payload
+        // Containers store the index of their end entry, and their end entry stores their element count
+        // Strings and keys store their offset into the string buffer, followed by an entry with their length
+        // Numbers store whether they were positive, followed by an entry with their value
+        // Dates, times, and booleans are packed into the payload
+        // Datetimes store their date and zone, followed by an entry with their packed time
+        enum class _Tag : u8
+        {
+            null,
+            object,
+            array,
+            string,
+            integer,
+            floater,
+            boolean,
+            date,
+            time,
+            datetime,
+            key,
+            end
+        };
+
+        static_assert(u8(_Tag::datetime) == u8(Type::datetime), "The value tags must match `Type`");
+
+        std::vector<u64> _entries{};
+        std::string _strings{};
+
+        [[nodiscard]] static u64 _entry(_Tag tag, u64 payload = 0u) { return (u64(tag) << 56) | payload; }
+
+        [[nodiscard]] _Tag _tag(u64 i) const { return _Tag(_entries[i] >> 56); }
+
+        [[nodiscard]] u64 _payload(u64 i) const { return _entries[i] & 0x00FF'FFFF'FFFF'FFFFu; }
+
+        [[nodiscard]] u64 _next(u64 i) const;
+
+        [[nodiscard]] std::string_view _string(u64 i) const { return {_strings.data() + _payload(i), _entries[i + 1u]}; }
+
+        [[nodiscard]] static u64 _packDate(const Date & date);
+
+        [[nodiscard]] static Date _unpackDate(u64 packed);
+
+        [[nodiscard]] static u64 _packTime(const Time & time);
+
+        [[nodiscard]] static Time _unpackTime(u64 packed);
+
+        void _pushString(_Tag tag, std::string_view str);
+
+        friend TapeValue;
+        friend std::optional<Tape> _private::decodeTapeRoot(Decoder & decoder);
+    };
+
+    ///
+    /// Decodes the given QCON string into a tape
+    /// The QSON string *must* be null terminated (optimization allowing most range checks to be eliminated)
+    /// @param qcon QCON string to decode
+    /// @return decoded tape of the QCON, or empty if the string is invalid or could otherwise not be decoded
+    ///
+    [[nodiscard]] std::optional<Tape> decodeTape(const char * qcon);
+    [[nodiscard]] std::optional<Tape> decodeTape(const std::string & qcon) { return decodeTape(qcon.c_str()); }
+    [[nodiscard]] std::optional<Tape> decodeTape(std::string &&) = delete; /// Prevent binding to temporary
+
+    ///
+    /// Decodes the given bounded QCON string into a tape
+    /// See `Decoder::load` for the meaning of `padded`
+    /// @param qcon QCON string to decode; need not be null terminated
+    /// @param length number of characters in the QCON
+    /// @param padded whether `qcon[length]` is readable
+    /// @return decoded tape of the QCON, or empty if the string is invalid or could otherwise not be decoded
+    ///
+    [[nodiscard]] std::optional<Tape> decodeTape(const char * qcon, u64 length, bool padded = false);
+    [[nodiscard]] std::optional<Tape> decodeTape(std::string_view qcon) { return decodeTape(qcon.data(), qcon.size()); }
+
+    ///
+    /// Decodes the given QCON file into a tape, which is memory mapped rather than read into memory
+    /// @param path path of the QCON file to decode
+    /// @return decoded tape of the QCON, or empty if the file could not be opened or is invalid
+    ///
+    [[nodiscard]] std::optional<Tape> decodeTapeFile(const std::filesystem::path & path);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -314,7 +851,7 @@ namespace qcon
             }
             case Type::string:
             {
-                encoder << *v._string;
+                encoder << *v.string();
                 break;
             }
             case Type::integer:
@@ -341,12 +878,12 @@ namespace qcon
             }
             case Type::date:
             {
-                encoder << v._datetime->date;
+                encoder << v._date;
                 break;
             }
             case Type::time:
             {
-                encoder << v._datetime->time;
+                encoder << v._time;
                 break;
             }
             case Type::datetime:
@@ -370,14 +907,16 @@ namespace qcon
     {}
 
     inline Value::Value(std::string && v) :
-        _string{new std::string(std::move(v))},
         _type{Type::string}
-    {}
+    {
+        _setString(std::move(v));
+    }
 
     inline Value::Value(const std::string_view v) :
-        _string{new std::string(v)},
         _type{Type::string}
-    {}
+    {
+        _setString(v);
+    }
 
     inline Value::Value(const char * const v) :
         Value(std::string_view{v})
@@ -443,12 +982,12 @@ namespace qcon
     {}
 
     inline Value::Value(const Date & v) :
-        _datetime{new Datetime{.date = v}},
+        _date{v},
         _type{Type::date}
     {}
 
     inline Value::Value(const Time & v) :
-        _datetime{new Datetime{.time = v}},
+        _time{v},
         _type{Type::time}
     {}
 
@@ -462,12 +1001,12 @@ namespace qcon
         _type{Type::null}
     {}
 
-    inline Value::Value(Value && other) :
-        _integer{other._integer},
-        _type{other._type},
-        _positive{other._positive}
+    inline Value::Value(Value && other)
     {
+        // All state is trivially copyable, including any inline string
+        std::memcpy(static_cast<void *>(this), &other, sizeof(Value));
         other._type = Type::null;
+        other._arena = false;
     }
 
     inline Value & Value::operator=(Object && v)
@@ -502,7 +1041,12 @@ namespace qcon
 
     inline Value & Value::operator=(std::string && v)
     {
-        if (_type == Type::string)
+        if (v.size() <= _shortStringMax)
+        {
+            return *this = std::string_view{v};
+        }
+
+        if (_type == Type::string && _shortSize == _longString)
         {
             *_string = std::move(v);
         }
@@ -510,14 +1054,23 @@ namespace qcon
         {
             _deleteValue();
             _type = Type::string;
-            _string = new std::string(std::move(v));
+            _setString(std::move(v));
         }
         return *this;
     }
 
     inline Value & Value::operator=(const std::string_view v)
     {
-        if (_type == Type::string)
+        if (v.size() <= _shortStringMax)
+        {
+            // Copied out first in case it views this value's own string
+            char chars[_shortStringMax];
+            std::memcpy(chars, v.data(), v.size());
+            _deleteValue();
+            _type = Type::string;
+            _setString(std::string_view{chars, v.size()});
+        }
+        else if (_type == Type::string && _shortSize == _longString)
         {
             *_string = v;
         }
@@ -525,7 +1078,7 @@ namespace qcon
         {
             _deleteValue();
             _type = Type::string;
-            _string = new std::string(v);
+            _setString(v);
         }
         return *this;
     }
@@ -624,46 +1177,38 @@ namespace qcon
 
     inline Value & Value::operator=(const Date & v)
     {
-        if (_type == Type::date || _type == Type::time || _type == Type::datetime)
-        {
-            _datetime->date = v;
-        }
-        else
+        if (_type != Type::date)
         {
             _deleteValue();
-            _datetime = new Datetime{.date = v};
+            _type = Type::date;
         }
-        _type = Type::date;
+        _date = v;
         return *this;
     }
 
     inline Value & Value::operator=(const Time & v)
     {
-        if (_type == Type::date || _type == Type::time || _type == Type::datetime)
-        {
-            _datetime->time = v;
-        }
-        else
+        if (_type != Type::time)
         {
             _deleteValue();
-            _datetime = new Datetime{.time = v};
+            _type = Type::time;
         }
-        _type = Type::time;
+        _time = v;
         return *this;
     }
 
     inline Value & Value::operator=(const Datetime & v)
     {
-        if (_type == Type::date || _type == Type::time || _type == Type::datetime)
+        if (_type == Type::datetime)
         {
             *_datetime = v;
         }
         else
         {
             _deleteValue();
+            _type = Type::datetime;
             _datetime = new Datetime{v};
         }
-        _type = Type::datetime;
         return *this;
     }
 
@@ -681,10 +1226,9 @@ namespace qcon
     inline Value & Value::operator=(Value && other)
     {
         _deleteValue();
-        _integer = other._integer;
-        _type = other._type;
-        _positive = other._positive;
+        std::memcpy(static_cast<void *>(this), &other, sizeof(Value));
         other._type = Type::null;
+        other._arena = false;
         return *this;
     }
 
@@ -713,14 +1257,14 @@ namespace qcon
         return _type == Type::array ? _array : nullptr;
     }
 
-    inline std::string * Value::string()
+    inline std::optional<std::string_view> Value::string() const
     {
-        return _type == Type::string ? _string : nullptr;
-    }
+        if (_type != Type::string)
+        {
+            return {};
+        }
 
-    inline const std::string * Value::string() const
-    {
-        return _type == Type::string ? _string : nullptr;
+        return _shortSize == _longString ? std::string_view{*_string} : std::string_view{_shortChars(), _shortSize};
     }
 
     inline s64 * Value::integer()
@@ -755,22 +1299,22 @@ namespace qcon
 
     inline Date * Value::date()
     {
-        return _type == Type::date || _type == Type::datetime ? &_datetime->date : nullptr;
+        return _type == Type::date ? &_date : _type == Type::datetime ? &_datetime->date : nullptr;
     }
 
     inline const Date * Value::date() const
     {
-        return _type == Type::date || _type == Type::datetime ? &_datetime->date : nullptr;
+        return _type == Type::date ? &_date : _type == Type::datetime ? &_datetime->date : nullptr;
     }
 
     inline Time * Value::time()
     {
-        return _type == Type::time || _type == Type::datetime ? &_datetime->time : nullptr;
+        return _type == Type::time ? &_time : _type == Type::datetime ? &_datetime->time : nullptr;
     }
 
     inline const Time * Value::time() const
     {
-        return _type == Type::time || _type == Type::datetime ? &_datetime->time : nullptr;
+        return _type == Type::time ? &_time : _type == Type::datetime ? &_datetime->time : nullptr;
     }
 
     inline Datetime * Value::datetime()
@@ -793,6 +1337,30 @@ namespace qcon
         return _type == Type::null ? &_null : nullptr;
     }
 
+    inline Value * Value::find(const std::string_view key)
+    {
+        return const_cast<Value *>(std::as_const(*this).find(key));
+    }
+
+    inline const Value * Value::find(const std::string_view key) const
+    {
+        if (_type != Type::object)
+        {
+            return nullptr;
+        }
+
+        const Object::const_iterator it{_object->find(key)};
+        return it == _object->cend() ? nullptr : &it->second;
+    }
+
+    inline const Value & Value::operator[](const std::string_view key) const
+    {
+        static const Value null{};
+
+        const Value * const v{find(key)};
+        return v ? *v : null;
+    }
+
     inline bool Value::operator==(const Value & other) const
     {
         switch (other._type)
@@ -800,12 +1368,12 @@ namespace qcon
             case Type::null: return *this == other._null;
             case Type::object: return *this == *other._object;
             case Type::array: return *this == *other._array;
-            case Type::string: return *this == *other._string;
+            case Type::string: return *this == *other.string();
             case Type::integer: return *this == other._integer;
             case Type::floater: return *this == other._floater;
             case Type::boolean: return *this == other._boolean;
-            case Type::date: return *this == other._datetime->date;
-            case Type::time: return *this == other._datetime->time;
+            case Type::date: return *this == other._date;
+            case Type::time: return *this == other._time;
             case Type::datetime: return *this == *other._datetime;
             default: return false;
         }
@@ -828,7 +1396,7 @@ namespace qcon
 
     inline bool Value::operator==(const std::string_view v) const
     {
-        return _type == Type::string && *_string == v;
+        return _type == Type::string && *string() == v;
     }
 
     inline bool Value::operator==(const char * const v) const
@@ -898,12 +1466,12 @@ namespace qcon
 
     inline bool Value::operator==(const Date & v) const
     {
-        return _type == Type::date && _datetime->date == v;
+        return _type == Type::date && _date == v;
     }
 
     inline bool Value::operator==(const Time & v) const
     {
-        return _type == Type::time && _datetime->time == v;
+        return _type == Type::time && _time == v;
     }
 
     inline bool Value::operator==(const Datetime & v) const
@@ -916,20 +1484,290 @@ namespace qcon
         return _type == Type::null;
     }
 
+    inline void Value::_setString(const std::string_view v)
+    {
+        // Inline strings are written from the start of the union on into `_shortTail`, so it must directly follow
+        static_assert(offsetof(Value, _shortTail) == sizeof(_integer) && sizeof(_shortTail) == _shortStringMax - sizeof(_integer));
+
+        if (v.size() <= _shortStringMax)
+        {
+            std::memmove(_shortChars(), v.data(), v.size());
+            _shortSize = u8(v.size());
+        }
+        else
+        {
+            _string = new std::string(v);
+            _shortSize = _longString;
+        }
+    }
+
+    inline void Value::_setString(std::string && v)
+    {
+        if (v.size() <= _shortStringMax)
+        {
+            _setString(std::string_view{v});
+        }
+        else
+        {
+            _string = new std::string(std::move(v));
+            _shortSize = _longString;
+        }
+    }
+
     inline void Value::_deleteValue()
     {
+        // Arena allocations are only destroyed, and are freed all at once with their arena
+        if (_arena)
+        {
+            switch (_type)
+            {
+                case Type::object: _object->~Object(); break;
+                case Type::array: _array->~Array(); break;
+                case Type::string: _string->~basic_string(); break;
+                case Type::datetime: _datetime->~Datetime(); break;
+                default: break;
+            }
+            _arena = false;
+            return;
+        }
+
         switch (_type)
         {
             case Type::object: delete _object; break;
             case Type::array: delete _array; break;
-            case Type::string: delete _string; break;
-            case Type::date: [[fallthrough]];
-            case Type::time: [[fallthrough]];
+            case Type::string: if (_shortSize == _longString) delete _string; break;
             case Type::datetime: delete _datetime; break;
             default: break;
         }
     }
 
+    inline Object::Object(std::pmr::memory_resource & resource) :
+        _elements{&resource},
+        _hashes{&resource},
+        _index{&resource}
+    {}
+
+    inline Object::Object(std::vector<value_type> && elements)
+    {
+        reserve(elements.size());
+        for (value_type & element : elements)
+        {
+            _insert(std::move(element));
+        }
+    }
+
+    inline void Object::clear()
+    {
+        _elements.clear();
+        _hashes.clear();
+        _index.clear();
+    }
+
+    inline void Object::reserve(const size_type capacity)
+    {
+        _elements.reserve(capacity);
+        _hashes.reserve(capacity);
+    }
+
+    inline Object::iterator Object::find(const std::string_view key)
+    {
+        return _elements.begin() + ptrdiff_t(_find(key, _hash(key)));
+    }
+
+    inline Object::const_iterator Object::find(const std::string_view key) const
+    {
+        return _elements.cbegin() + ptrdiff_t(_find(key, _hash(key)));
+    }
+
+    inline bool Object::contains(const std::string_view key) const
+    {
+        return _find(key, _hash(key)) != _elements.size();
+    }
+
+    inline Object::size_type Object::count(const std::string_view key) const
+    {
+        return contains(key);
+    }
+
+    inline Value & Object::at(const std::string_view key)
+    {
+        return const_cast<Value &>(std::as_const(*this).at(key));
+    }
+
+    inline const Value & Object::at(const std::string_view key) const
+    {
+        const u64 i{_find(key, _hash(key))};
+        if (i == _elements.size())
+        {
+            throw std::out_of_range{"No object element with the given key"};
+        }
+
+        return _elements[i].second;
+    }
+
+    inline Value & Object::operator[](const std::string_view key)
+    {
+        const u64 i{_find(key, _hash(key))};
+        return i == _elements.size() ? _insert(value_type{key_type{key}, nullptr}).first->second : _elements[i].second;
+    }
+
+    inline Value & Object::operator[](key_type && key)
+    {
+        const u64 i{_find(key, _hash(key))};
+        return i == _elements.size() ? _insert(value_type{std::move(key), nullptr}).first->second : _elements[i].second;
+    }
+
+    template <typename K, typename... Args>
+    inline std::pair<Object::iterator, bool> Object::emplace(K && key, Args &&... args)
+    {
+        return _insert(value_type{key_type{std::forward<K>(key)}, Value{std::forward<Args>(args)...}});
+    }
+
+    inline std::pair<Object::iterator, bool> Object::insert(value_type && element)
+    {
+        return _insert(std::move(element));
+    }
+
+    inline Object::iterator Object::erase(const const_iterator pos)
+    {
+        const ptrdiff_t i{pos - _elements.cbegin()};
+        _hashes.erase(_hashes.cbegin() + i);
+        const iterator next{_elements.erase(pos)};
+
+        // The positions of all following elements changed
+        _reindex();
+
+        return next;
+    }
+
+    inline Object::size_type Object::erase(const std::string_view key)
+    {
+        const u64 i{_find(key, _hash(key))};
+        if (i == _elements.size())
+        {
+            return 0u;
+        }
+
+        erase(_elements.cbegin() + ptrdiff_t(i));
+        return 1u;
+    }
+
+    inline bool Object::operator==(const Object & other) const
+    {
+        if (_elements.size() != other._elements.size())
+        {
+            return false;
+        }
+
+        for (u64 i{0u}; i < _elements.size(); ++i)
+        {
+            const u64 j{other._find(_elements[i].first, _hashes[i])};
+            if (j == other._elements.size() || !(_elements[i].second == other._elements[j].second))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    inline u32 Object::_hash(const std::string_view key)
+    {
+        return u32(std::hash<std::string_view>{}(key));
+    }
+
+    inline u64 Object::_find(const std::string_view key, const u32 hash) const
+    {
+        const u64 size{_elements.size()};
+
+        if (_index.empty())
+        {
+            for (u64 i{0u}; i < size; ++i)
+            {
+                if (_hashes[i] == hash && _elements[i].first == key)
+                {
+                    return i;
+                }
+            }
+
+            return size;
+        }
+
+        const u64 mask{_index.size() - 1u};
+        for (u64 slot{hash & mask}; _index[slot]; slot = (slot + 1u) & mask)
+        {
+            const u64 i{_index[slot] - 1u};
+            if (_hashes[i] == hash && _elements[i].first == key)
+            {
+                return i;
+            }
+        }
+
+        return size;
+    }
+
+    inline std::pair<Object::iterator, bool> Object::_insert(value_type && element)
+    {
+        const u32 hash{_hash(element.first)};
+
+        const u64 i{_find(element.first, hash)};
+        if (i != _elements.size())
+        {
+            return {_elements.begin() + ptrdiff_t(i), false};
+        }
+
+        // Skip the smallest, most frequent reallocations
+        if (!_elements.capacity())
+        {
+            reserve(8u);
+        }
+
+        _elements.push_back(std::move(element));
+        _hashes.push_back(hash);
+
+        // Keep the index at most half full
+        if (_elements.size() > _linearSearchMax)
+        {
+            if (_elements.size() * 2u > _index.size())
+            {
+                _reindex();
+            }
+            else
+            {
+                _indexElement(i);
+            }
+        }
+
+        return {_elements.begin() + ptrdiff_t(i), true};
+    }
+
+    inline void Object::_indexElement(const u64 i)
+    {
+        const u64 mask{_index.size() - 1u};
+        u64 slot{_hashes[i] & mask};
+        while (_index[slot])
+        {
+            slot = (slot + 1u) & mask;
+        }
+        _index[slot] = u32(i + 1u);
+    }
+
+    inline void Object::_reindex()
+    {
+        const u64 size{_elements.size()};
+        if (size <= _linearSearchMax)
+        {
+            _index.clear();
+            return;
+        }
+
+        _index.assign(std::bit_ceil(size * 4u), 0u);
+        for (u64 i{0u}; i < size; ++i)
+        {
+            _indexElement(i);
+        }
+    }
+
     namespace _private
     {
         template <typename K, typename V, typename... MoreKVs>
@@ -967,11 +1805,69 @@ namespace qcon
         return arr;
     }
 
+    inline Document::Document() :
+        _arena{std::make_unique<std::pmr::monotonic_buffer_resource>(_initialArenaSize)}
+    {}
+
+    inline Document & Document::operator=(Document && other)
+    {
+        // The old root must be destroyed before its arena
+        _root = std::move(other._root);
+        _arena = std::move(other._arena);
+        return *this;
+    }
+
     namespace _private
     {
-        inline bool decodeArray(Decoder & decoder, Array & array);
+        template <typename T>
+        inline Value arenaValue(std::pmr::memory_resource * const arena, T && v)
+        {
+            using U = std::remove_cvref_t<T>;
+
+            if (!arena)
+            {
+                return Value{std::forward<T>(v)};
+            }
+
+            // Containers are also given the arena for their storage
+            std::pmr::polymorphic_allocator<> allocator{arena};
+            Value value{};
+            if constexpr (std::is_same_v<U, Object>)
+            {
+                value._object = allocator.new_object<Object>(*arena);
+                *value._object = std::move(v);
+                value._type = Type::object;
+            }
+            else if constexpr (std::is_same_v<U, Array>)
+            {
+                value._array = allocator.new_object<Array>();
+                *value._array = std::move(v);
+                value._type = Type::array;
+            }
+            else if constexpr (std::is_same_v<U, std::string>)
+            {
+                // Short strings are stored inline
+                if (v.size() <= Value::_shortStringMax)
+                {
+                    return Value{std::string_view{v}};
+                }
+                value._string = allocator.new_object<std::string>(std::forward<T>(v));
+                value._shortSize = Value::_longString;
+                value._type = Type::string;
+            }
+            else
+            {
+                static_assert(std::is_same_v<U, Datetime>, "Only objects, arrays, strings, and datetimes are allocated");
+                value._datetime = allocator.new_object<Datetime>(v);
+                value._type = Type::datetime;
+            }
+            value._arena = true;
+            return value;
+        }
+
+        inline bool decodeArray(Decoder & decoder, Array & array, std::pmr::memory_resource * arena);
 
-        inline bool decodeObject(Decoder & decoder, Object & object)
+        inline bool decodeObject(Decoder & decoder, Object & object, std::pmr::memory_resource * const arena)
         {
             while (true)
             {
@@ -979,8 +1875,8 @@ namespace qcon
                 {
                     case DecodeState::object:
                     {
-                        Value & v{object.emplace(std::move(decoder.key), Object{}).first->second};
-                        if (!decodeObject(decoder, *v.object()))
+                        Value & v{object.emplace(std::move(decoder.key), arenaValue(arena, Object{})).first->second};
+                        if (!decodeObject(decoder, *v.object(), arena))
                         {
                             return false;
                         }
@@ -988,8 +1884,8 @@ namespace qcon
                     }
                     case DecodeState::array:
                     {
-                        Value & v{object.emplace(std::move(decoder.key), Array{}).first->second};
-                        if (!decodeArray(decoder, *v.array()))
+                        Value & v{object.emplace(std::move(decoder.key), arenaValue(arena, Array{})).first->second};
+                        if (!decodeArray(decoder, *v.array(), arena))
                         {
                             return false;
                         }
@@ -1005,7 +1901,7 @@ namespace qcon
                     }
                     case DecodeState::string:
                     {
-                        object.emplace(std::move(decoder.key), std::move(decoder.string));
+                        object.emplace(std::move(decoder.key), arenaValue(arena, std::move(decoder.string)));
                         break;
                     }
                     case DecodeState::integer:
@@ -1042,7 +1938,7 @@ namespace qcon
                     }
                     case DecodeState::datetime:
                     {
-                        object.emplace(std::move(decoder.key), decoder.datetime);
+                        object.emplace(std::move(decoder.key), arenaValue(arena, decoder.datetime));
                         break;
                     }
                     case DecodeState::null:
@@ -1058,7 +1954,7 @@ namespace qcon
             }
         }
 
-        inline bool decodeArray(Decoder & decoder, Array & array)
+        inline bool decodeArray(Decoder & decoder, Array & array, std::pmr::memory_resource * const arena)
         {
             while (true)
             {
@@ -1066,8 +1962,8 @@ namespace qcon
                 {
                     case DecodeState::object:
                     {
-                        Value & v{array.emplace_back(Object{})};
-                        if (!decodeObject(decoder, *v.object()))
+                        Value & v{array.emplace_back(arenaValue(arena, Object{}))};
+                        if (!decodeObject(decoder, *v.object(), arena))
                         {
                             return false;
                         }
@@ -1075,8 +1971,8 @@ namespace qcon
                     }
                     case DecodeState::array:
                     {
-                        Value & v{array.emplace_back(Array{})};
-                        if (!decodeArray(decoder, *v.array()))
+                        Value & v{array.emplace_back(arenaValue(arena, Array{}))};
+                        if (!decodeArray(decoder, *v.array(), arena))
                         {
                             return false;
                         }
@@ -1088,7 +1984,7 @@ namespace qcon
                     }
                     case DecodeState::string:
                     {
-                        array.push_back(std::move(decoder.string));
+                        array.push_back(arenaValue(arena, std::move(decoder.string)));
                         break;
                     }
                     case DecodeState::integer:
@@ -1125,7 +2021,7 @@ namespace qcon
                     }
                     case DecodeState::datetime:
                     {
-                        array.push_back(decoder.datetime);
+                        array.push_back(arenaValue(arena, decoder.datetime));
                         break;
                     }
                     case DecodeState::null:
@@ -1140,95 +2036,344 @@ namespace qcon
                 }
             }
         }
-    }
-
-    inline std::optional<Value> decode(const char * const qcon)
-    {
-        Value value{};
-        Decoder decoder{qcon};
 
-        switch (decoder.step())
+        inline bool decodeValue(Decoder & decoder, Value & value, std::pmr::memory_resource * const arena)
         {
-            case DecodeState::object:
+            switch (decoder.step())
             {
-                Object obj{};
-                if (!_private::decodeObject(decoder, obj))
+                case DecodeState::object:
                 {
-                    return {};
+                    value = arenaValue(arena, Object{});
+                    if (!_private::decodeObject(decoder, *value.object(), arena))
+                    {
+                        return false;
+                    }
+                    break;
                 }
-                value = std::move(obj);
-                break;
-            }
-            case DecodeState::array:
-            {
-                Array arr{};
-                if (!_private::decodeArray(decoder, arr))
+                case DecodeState::array:
                 {
-                    return {};
+                    value = arenaValue(arena, Array{});
+                    if (!_private::decodeArray(decoder, *value.array(), arena))
+                    {
+                        return false;
+                    }
+                    break;
                 }
-                value = std::move(arr);
-                break;
-            }
-            case DecodeState::string:
-            {
-                value = std::move(decoder.string);
-                break;
-            }
-            case DecodeState::integer:
-            {
-                if (decoder.positive)
+                case DecodeState::string:
                 {
-                    value = u64(decoder.integer);
+                    value = arenaValue(arena, std::move(decoder.string));
+                    break;
                 }
-                else
+                case DecodeState::integer:
                 {
-                    value = decoder.integer;
+                    if (decoder.positive)
+                    {
+                        value = u64(decoder.integer);
+                    }
+                    else
+                    {
+                        value = decoder.integer;
+                    }
+                    break;
+                }
+                case DecodeState::floater:
+                {
+                    value = decoder.floater;
+                    break;
+                }
+                case DecodeState::boolean:
+                {
+                    value = decoder.boolean;
+                    break;
+                }
+                case DecodeState::date:
+                {
+                    value = decoder.date;
+                    break;
+                }
+                case DecodeState::time:
+                {
+                    value = decoder.time;
+                    break;
+                }
+                case DecodeState::datetime:
+                {
+                    value = arenaValue(arena, decoder.datetime);
+                    break;
+                }
+                case DecodeState::null:
+                {
+                    break;
+                }
+                default:
+                {
+                    return false;
                 }
-                break;
-            }
-            case DecodeState::floater:
-            {
-                value = decoder.floater;
-                break;
-            }
-            case DecodeState::boolean:
-            {
-                value = decoder.boolean;
-                break;
-            }
-            case DecodeState::date:
-            {
-                value = decoder.date;
-                break;
             }
-            case DecodeState::time:
+
+            return bool(decoder);
+        }
+
+        inline std::optional<Value> decodeRoot(Decoder & decoder)
+        {
+            Value value{};
+
+            if (decodeValue(decoder, value, nullptr))
             {
-                value = decoder.time;
-                break;
+                return value;
             }
-            case DecodeState::datetime:
+            else
             {
-                value = decoder.datetime;
-                break;
+                return {};
             }
-            case DecodeState::null:
+        }
+
+        inline std::optional<Document> decodeArenaRoot(Decoder & decoder)
+        {
+            Document document{};
+
+            if (decodeValue(decoder, document._root, document._arena.get()))
             {
-                break;
+                return document;
             }
-            default:
+            else
             {
                 return {};
             }
         }
 
-        if (decoder)
+        // Divides the rest of the QCON into runs of roughly equal length, one per thread
+        inline u64 runLength(const Decoder & decoder, const u64 threads)
         {
-            return value;
+            // Only a null terminated QCON string must be measured
+            const char * const end{decoder.endPosition()};
+            const u64 length{end ? u64(end - decoder.position()) : std::strlen(decoder.position())};
+            return length / threads + 1u;
         }
-        else
+
+        // Decodes the values of each run, as found by `splitElements` or `splitDocuments`, then concatenates them
+        // Every run but the last is decoded on its own thread by its own decoder; the last is decoded by the original
+        //   decoder, which also ensures the QCON properly ends
+        // `qcon` is the start of the root array, and is only needed for elements
+        template <bool documents, typename Values>
+        inline std::optional<Values> decodeRuns(Decoder & decoder, const char * const qcon, const std::vector<const char *> & runStarts)
         {
-            return {};
+            const u64 runCount{runStarts.size()};
+            std::vector<Values> runs(runCount ? runCount : 1u);
+            std::vector<u8> succeeded(runCount);
+
+            const auto decodeRun{[&](const u64 run)
+            {
+                Decoder runDecoder{};
+                if constexpr (documents)
+                {
+                    runDecoder.documentStream = true;
+                    runDecoder.load(runStarts[run]);
+                }
+                else
+                {
+                    runDecoder.load(qcon);
+                    runDecoder >> array;
+                    runDecoder.seekElement(runStarts[run]);
+                }
+
+                const char * const runEnd{runStarts[run + 1u]};
+                while (runDecoder.position() < runEnd && (!documents || runDecoder.nextDocument()))
+                {
+                    if (!decodeValue(runDecoder, runs[run].emplace_back(), nullptr))
+                    {
+                        return;
+                    }
+                }
+
+                succeeded[run] = runDecoder.position() == runEnd;
+            }};
+
+            std::vector<std::thread> workers{};
+            for (u64 run{0u}; run + 1u < runCount; ++run)
+            {
+                workers.emplace_back(decodeRun, run);
+            }
+
+            if constexpr (documents)
+            {
+                if (runCount)
+                {
+                    decoder.seekDocument(runStarts.back());
+                }
+                while (decoder.nextDocument())
+                {
+                    if (!decodeValue(decoder, runs.back().emplace_back(), nullptr))
+                    {
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                if (runCount)
+                {
+                    decoder.seekElement(runStarts.back());
+                }
+                while (decoder.more())
+                {
+                    if (!decodeValue(decoder, runs.back().emplace_back(), nullptr))
+                    {
+                        break;
+                    }
+                }
+            }
+
+            for (std::thread & worker : workers)
+            {
+                worker.join();
+            }
+
+            if (!decoder)
+            {
+                return {};
+            }
+
+            u64 size{0u};
+            for (u64 run{0u}; run < runs.size(); ++run)
+            {
+                if (run + 1u < runCount && !succeeded[run])
+                {
+                    return {};
+                }
+                size += runs[run].size();
+            }
+
+            Values values(std::move(runs.front()));
+            values.reserve(size);
+            for (u64 run{1u}; run < runs.size(); ++run)
+            {
+                for (Value & value : runs[run])
+                {
+                    values.push_back(std::move(value));
+                }
+            }
+
+            return values;
         }
+
+        inline std::optional<Value> decodeRootParallel(Decoder & decoder, u64 threads)
+        {
+            if (!threads)
+            {
+                threads = std::thread::hardware_concurrency();
+            }
+
+            if (threads <= 1u || decoder.peekType() != DecodeState::array)
+            {
+                return decodeRoot(decoder);
+            }
+
+            const char * const qcon{decoder.position()};
+            decoder >> array;
+
+            std::optional<Array> elements{decodeRuns<false, Array>(decoder, qcon, decoder.splitElements(runLength(decoder, threads)))};
+            if (!elements)
+            {
+                return {};
+            }
+
+            return Value{std::move(*elements)};
+        }
+
+        inline std::optional<std::vector<Value>> decodeDocuments(Decoder & decoder, u64 threads)
+        {
+            if (!threads)
+            {
+                threads = std::thread::hardware_concurrency();
+            }
+
+            std::vector<const char *> runStarts{};
+            if (threads > 1u)
+            {
+                runStarts = decoder.splitDocuments(runLength(decoder, threads));
+            }
+
+            return decodeRuns<true, std::vector<Value>>(decoder, nullptr, runStarts);
+        }
+    }
+
+    inline std::optional<Value> decode(const char * const qcon)
+    {
+        Decoder decoder{qcon};
+        return _private::decodeRoot(decoder);
+    }
+
+    inline std::optional<Value> decode(const char * const qcon, const u64 length, const bool padded)
+    {
+        Decoder decoder{qcon, length, padded};
+        return _private::decodeRoot(decoder);
+    }
+
+    inline std::optional<Value> decodeFile(const std::filesystem::path & path)
+    {
+        Decoder decoder{};
+        decoder.loadFile(path);
+        return _private::decodeRoot(decoder);
+    }
+
+    inline std::optional<Value> decodeParallel(const char * const qcon, const u64 threads)
+    {
+        Decoder decoder{qcon};
+        return _private::decodeRootParallel(decoder, threads);
+    }
+
+    inline std::optional<Value> decodeParallel(const std::string & qcon, const u64 threads)
+    {
+        // Bounded so its length need not be found, but still decoded in place
+        Decoder decoder{qcon.c_str(), qcon.size(), true};
+        return _private::decodeRootParallel(decoder, threads);
+    }
+
+    inline std::optional<Value> decodeParallel(const std::string_view qcon, const u64 threads)
+    {
+        Decoder decoder{qcon};
+        return _private::decodeRootParallel(decoder, threads);
+    }
+
+    inline std::optional<Value> decodeFileParallel(const std::filesystem::path & path, const u64 threads)
+    {
+        Decoder decoder{};
+        decoder.loadFile(path);
+        return _private::decodeRootParallel(decoder, threads);
+    }
+
+    inline std::optional<std::vector<Value>> decodeDocuments(const char * const qcon, const u64 threads)
+    {
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load(qcon);
+        return _private::decodeDocuments(decoder, threads);
+    }
+
+    inline std::optional<std::vector<Value>> decodeDocuments(const std::string & qcon, const u64 threads)
+    {
+        // Bounded so its length need not be found, but still decoded in place
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load(qcon.c_str(), qcon.size(), true);
+        return _private::decodeDocuments(decoder, threads);
+    }
+
+    inline std::optional<std::vector<Value>> decodeDocuments(const std::string_view qcon, const u64 threads)
+    {
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load(qcon);
+        return _private::decodeDocuments(decoder, threads);
+    }
+
+    inline std::optional<std::vector<Value>> decodeFileDocuments(const std::filesystem::path & path, const u64 threads)
+    {
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.loadFile(path);
+        return _private::decodeDocuments(decoder, threads);
     }
 
     inline std::optional<std::string> encode(const Value & v, const Density density, const std::string_view indentStr)
@@ -1237,4 +2382,387 @@ namespace qcon
         encoder << v;
         return encoder.finish();
     }
+
+    inline TapeValue::Iterator::Iterator(const Tape * const tape, const u64 index) :
+        _tape{tape},
+        _index{index}
+    {}
+
+    inline TapeValue TapeValue::Iterator::operator*() const
+    {
+        return TapeValue{_tape, _tape->_tag(_index) == Tape::_Tag::key ? _index + 2u : _index};
+    }
+
+    inline std::string_view TapeValue::Iterator::key() const
+    {
+        return _tape->_string(_index);
+    }
+
+    inline TapeValue::Iterator & TapeValue::Iterator::operator++()
+    {
+        _index = _tape->_tag(_index) == Tape::_Tag::key ? _tape->_next(_index + 2u) : _tape->_next(_index);
+        return *this;
+    }
+
+    inline TapeValue::TapeValue(const Tape * const tape, const u64 index) :
+        _tape{tape},
+        _index{index}
+    {}
+
+    inline Type TapeValue::type() const
+    {
+        return Type(_tape->_tag(_index));
+    }
+
+    inline u64 TapeValue::size() const
+    {
+        const Tape::_Tag tag{_tape->_tag(_index)};
+        return tag == Tape::_Tag::object || tag == Tape::_Tag::array ? _tape->_payload(_tape->_payload(_index)) : 0u;
+    }
+
+    inline TapeValue::Iterator TapeValue::begin() const
+    {
+        const Tape::_Tag tag{_tape->_tag(_index)};
+        return Iterator{_tape, tag == Tape::_Tag::object || tag == Tape::_Tag::array ? _index + 1u : _index};
+    }
+
+    inline TapeValue::Iterator TapeValue::end() const
+    {
+        const Tape::_Tag tag{_tape->_tag(_index)};
+        return Iterator{_tape, tag == Tape::_Tag::object || tag == Tape::_Tag::array ? _tape->_payload(_index) : _index};
+    }
+
+    inline std::optional<TapeValue> TapeValue::find(const std::string_view key) const
+    {
+        if (_tape->_tag(_index) != Tape::_Tag::object)
+        {
+            return {};
+        }
+
+        const Iterator endIt{end()};
+        for (Iterator it{begin()}; it != endIt; ++it)
+        {
+            if (it.key() == key)
+            {
+                return *it;
+            }
+        }
+
+        return {};
+    }
+
+    inline std::optional<TapeValue> TapeValue::element(u64 i) const
+    {
+        if (_tape->_tag(_index) != Tape::_Tag::array)
+        {
+            return {};
+        }
+
+        const Iterator endIt{end()};
+        for (Iterator it{begin()}; it != endIt; ++it, --i)
+        {
+            if (!i)
+            {
+                return *it;
+            }
+        }
+
+        return {};
+    }
+
+    inline std::optional<std::string_view> TapeValue::string() const
+    {
+        if (_tape->_tag(_index) == Tape::_Tag::string)
+        {
+            return _tape->_string(_index);
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    inline std::optional<s64> TapeValue::integer() const
+    {
+        if (_tape->_tag(_index) == Tape::_Tag::integer)
+        {
+            return s64(_tape->_entries[_index + 1u]);
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    inline std::optional<f64> TapeValue::floater() const
+    {
+        if (_tape->_tag(_index) == Tape::_Tag::floater)
+        {
+            return std::bit_cast<f64>(_tape->_entries[_index + 1u]);
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    inline std::optional<bool> TapeValue::boolean() const
+    {
+        if (_tape->_tag(_index) == Tape::_Tag::boolean)
+        {
+            return bool(_tape->_payload(_index));
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    inline std::optional<Date> TapeValue::date() const
+    {
+        const Tape::_Tag tag{_tape->_tag(_index)};
+        if (tag == Tape::_Tag::date || tag == Tape::_Tag::datetime)
+        {
+            return Tape::_unpackDate(_tape->_payload(_index));
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    inline std::optional<Time> TapeValue::time() const
+    {
+        switch (_tape->_tag(_index))
+        {
+            case Tape::_Tag::time: return Tape::_unpackTime(_tape->_payload(_index));
+            case Tape::_Tag::datetime: return Tape::_unpackTime(_tape->_entries[_index + 1u]);
+            default: return {};
+        }
+    }
+
+    inline std::optional<Datetime> TapeValue::datetime() const
+    {
+        if (_tape->_tag(_index) == Tape::_Tag::datetime)
+        {
+            const u64 payload{_tape->_payload(_index)};
+            return Datetime{
+                .date = Tape::_unpackDate(payload),
+                .time = Tape::_unpackTime(_tape->_entries[_index + 1u]),
+                .zone = {.format = TimezoneFormat((payload >> 32) & 0b11u), .offset = s16(u16(payload >> 34))}};
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    inline bool TapeValue::null() const
+    {
+        return _tape->_tag(_index) == Tape::_Tag::null;
+    }
+
+    inline bool TapeValue::positive() const
+    {
+        const Tape::_Tag tag{_tape->_tag(_index)};
+        return (tag == Tape::_Tag::integer || tag == Tape::_Tag::floater) && _tape->_payload(_index);
+    }
+
+    inline u64 Tape::_next(const u64 i) const
+    {
+        switch (_tag(i))
+        {
+            case _Tag::object:
+            case _Tag::array:
+                return _payload(i) + 1u;
+            case _Tag::string:
+            case _Tag::integer:
+            case _Tag::floater:
+            case _Tag::datetime:
+            case _Tag::key:
+                return i + 2u;
+            default:
+                return i + 1u;
+        }
+    }
+
+    inline u64 Tape::_packDate(const Date & date)
+    {
+        return (u64(date.year) << 16) | (u64(date.month) << 8) | u64(date.day);
+    }
+
+    inline Date Tape::_unpackDate(const u64 packed)
+    {
+        return Date{.year = u16(packed >> 16), .month = u8(packed >> 8), .day = u8(packed)};
+    }
+
+    inline u64 Tape::_packTime(const Time & time)
+    {
+        return (u64(time.subsecond) << 17) | (u64(time.second) << 11) | (u64(time.minute) << 5) | u64(time.hour);
+    }
+
+    inline Time Tape::_unpackTime(const u64 packed)
+    {
+        return Time{.hour = u8(packed & 0x1Fu), .minute = u8((packed >> 5) & 0x3Fu), .second = u8((packed >> 11) & 0x3Fu), .subsecond = u32(packed >> 17)};
+    }
+
+    inline void Tape::_pushString(const _Tag tag, const std::string_view str)
+    {
+        _entries.push_back(_entry(tag, _strings.size()));
+        _entries.push_back(str.size());
+        _strings.append(str);
+    }
+
+    namespace _private
+    {
+        inline std::optional<Tape> decodeTapeRoot(Decoder & decoder)
+        {
+            using Tag = Tape::_Tag;
+
+            Tape tape{};
+            std::vector<u64> & entries{tape._entries};
+
+            // Entry index and element count of each open container
+            std::vector<std::pair<u64, u64>> open{};
+
+            decoder.zeroCopy = true;
+
+            do
+            {
+                const DecodeState state{decoder.step()};
+
+                if (state == DecodeState::key)
+                {
+                    tape._pushString(Tag::key, decoder.keyView);
+                    continue;
+                }
+
+                if (state == DecodeState::end)
+                {
+                    const auto [start, count]{open.back()};
+                    open.pop_back();
+                    entries[start] |= entries.size();
+                    entries.push_back(Tape::_entry(Tag::end, count));
+                    continue;
+                }
+
+                if (!open.empty())
+                {
+                    ++open.back().second;
+                }
+
+                switch (state)
+                {
+                    case DecodeState::object:
+                    {
+                        open.emplace_back(entries.size(), 0u);
+                        entries.push_back(Tape::_entry(Tag::object));
+                        break;
+                    }
+                    case DecodeState::array:
+                    {
+                        open.emplace_back(entries.size(), 0u);
+                        entries.push_back(Tape::_entry(Tag::array));
+                        break;
+                    }
+                    case DecodeState::string:
+                    {
+                        tape._pushString(Tag::string, decoder.stringView);
+                        break;
+                    }
+                    case DecodeState::integer:
+                    {
+                        entries.push_back(Tape::_entry(Tag::integer, decoder.positive));
+                        entries.push_back(u64(decoder.integer));
+                        break;
+                    }
+                    case DecodeState::floater:
+                    {
+                        entries.push_back(Tape::_entry(Tag::floater, decoder.floater >= 0.0));
+                        entries.push_back(std::bit_cast<u64>(decoder.floater));
+                        break;
+                    }
+                    case DecodeState::boolean:
+                    {
+                        entries.push_back(Tape::_entry(Tag::boolean, decoder.boolean));
+                        break;
+                    }
+                    case DecodeState::date:
+                    {
+                        entries.push_back(Tape::_entry(Tag::date, Tape::_packDate(decoder.date)));
+                        break;
+                    }
+                    case DecodeState::time:
+                    {
+                        entries.push_back(Tape::_entry(Tag::time, Tape::_packTime(decoder.time)));
+                        break;
+                    }
+                    case DecodeState::datetime:
+                    {
+                        const Datetime & datetime{decoder.datetime};
+                        const u64 zone{u64(datetime.zone.format) | (u64(u16(datetime.zone.offset)) << 2)};
+                        entries.push_back(Tape::_entry(Tag::datetime, Tape::_packDate(datetime.date) | (zone << 32)));
+                        entries.push_back(Tape::_packTime(datetime.time));
+                        break;
+                    }
+                    case DecodeState::null:
+                    {
+                        entries.push_back(Tape::_entry(Tag::null));
+                        break;
+                    }
+                    default:
+                    {
+                        return {};
+                    }
+                }
+            } while (!open.empty());
+
+            if (decoder)
+            {
+                return tape;
+            }
+            else
+            {
+                return {};
+            }
+        }
+    }
+
+    inline std::optional<Document> decodeArena(const char * const qcon)
+    {
+        Decoder decoder{qcon};
+        return _private::decodeArenaRoot(decoder);
+    }
+
+    inline std::optional<Document> decodeArena(const char * const qcon, const u64 length, const bool padded)
+    {
+        Decoder decoder{qcon, length, padded};
+        return _private::decodeArenaRoot(decoder);
+    }
+
+    inline std::optional<Document> decodeArenaFile(const std::filesystem::path & path)
+    {
+        Decoder decoder{};
+        decoder.loadFile(path);
+        return _private::decodeArenaRoot(decoder);
+    }
+
+    inline std::optional<Tape> decodeTape(const char * const qcon)
+    {
+        Decoder decoder{qcon};
+        return _private::decodeTapeRoot(decoder);
+    }
+
+    inline std::optional<Tape> decodeTape(const char * const qcon, const u64 length, const bool padded)
+    {
+        Decoder decoder{qcon, length, padded};
+        return _private::decodeTapeRoot(decoder);
+    }
+
+    inline std::optional<Tape> decodeTapeFile(const std::filesystem::path & path)
+    {
+        Decoder decoder{};
+        decoder.loadFile(path);
+        return _private::decodeTapeRoot(decoder);
+    }
 }
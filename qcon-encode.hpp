@@ -12,6 +12,8 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -195,6 +197,14 @@ namespace qcon
         [[nodiscard]] bool _encode(const Datetime & v);
         [[nodiscard]] bool _encode(nullptr_t);
     };
+
+    ///
+    /// Encodes the struct as an object according to its `Binding`, with its members in the order they were bound
+    /// @param encoder encoder to encode into
+    /// @param v struct to encode
+    /// @return the encoder
+    ///
+    template <Bound T> Encoder & operator<<(Encoder & encoder, const T & v);
 }
 
 ///
@@ -218,6 +228,31 @@ namespace qcon
             '4', '5', '6', '7',
             '8', '9', 'A', 'B',
             'C', 'D', 'E', 'F'};
+
+        template <typename M> inline void encodeMember(Encoder & encoder, const M & v)
+        {
+            if constexpr (isVector<M>)
+            {
+                encoder << array;
+                for (const auto & element : v)
+                {
+                    encodeMember(encoder, element);
+                }
+                encoder << end;
+            }
+            else if constexpr (std::is_same_v<M, std::chrono::year_month_day>)
+            {
+                encoder << Date::from(v);
+            }
+            else if constexpr (isDuration<M>)
+            {
+                encoder << Time::from(v);
+            }
+            else
+            {
+                encoder << v;
+            }
+        }
     }
 
     inline Encoder::Encoder(const Density density, const std::string_view indentStr) :
@@ -1072,4 +1107,14 @@ namespace qcon
 
         return true;
     }
+
+    template <Bound T> inline Encoder & operator<<(Encoder & encoder, const T & v)
+    {
+        encoder << object;
+        std::apply([&](const auto &... fields)
+        {
+            ((encoder << fields.key, _private::encodeMember(encoder, v.*fields.member)), ...);
+        }, Binding<T>::fields);
+        return encoder << end;
+    }
 }
@@ -1,6 +1,14 @@
 #include <qcon-decode.hpp>
 
+#include <bit>
+#include <charconv>
 #include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -19,7 +27,12 @@ using namespace std::string_literals;
 using namespace std::string_view_literals;
 
 using qcon::Decoder;
+using qcon::PushDecoder;
+using qcon::StructuralIndex;
+using qcon::OnDemand;
+using qcon::OnDemandValue;
 using qcon::DecodeState;
+using qcon::ErrorCode;
 using qcon::Date;
 using qcon::Time;
 using qcon::Datetime;
@@ -44,11 +57,35 @@ std::ostream & operator<<(std::ostream & os, const DecodeState state)
         case DecodeState::time: os << "time"; break;
         case DecodeState::datetime: os << "datetime"; break;
         case DecodeState::null: os << "null"; break;
+        case DecodeState::skipped: os << "skipped"; break;
     }
 
     return os;
 }
 
+struct BoundVal { std::string name; std::vector<s32> vals; };
+struct BoundOuter { std::vector<BoundVal> inner; std::chrono::year_month_day date; std::chrono::minutes time; bool flag; };
+struct BoundMany { s32 a, ab, abc, b, ba, bab, c, cb, cbc, d, dc, dcd, e, ed, ede, f; };
+
+template <> struct qcon::Binding<BoundVal>
+{
+    static constexpr auto fields{qcon::fields("Name", &BoundVal::name, "Vals", &BoundVal::vals)};
+};
+
+template <> struct qcon::Binding<BoundOuter>
+{
+    static constexpr auto fields{qcon::fields("Inner", &BoundOuter::inner, "Date", &BoundOuter::date, "Time", &BoundOuter::time, "Flag", &BoundOuter::flag)};
+};
+
+template <> struct qcon::Binding<BoundMany>
+{
+    static constexpr auto fields{qcon::fields(
+        "a", &BoundMany::a, "ab", &BoundMany::ab, "abc", &BoundMany::abc, "b", &BoundMany::b,
+        "ba", &BoundMany::ba, "bab", &BoundMany::bab, "c", &BoundMany::c, "cb", &BoundMany::cb,
+        "cbc", &BoundMany::cbc, "d", &BoundMany::d, "dc", &BoundMany::dc, "dcd", &BoundMany::dcd,
+        "e", &BoundMany::e, "ed", &BoundMany::ed, "ede", &BoundMany::ede, "f", &BoundMany::f)};
+};
+
 bool fails(const char * str)
 {
     Decoder decoder{str};
@@ -491,6 +528,104 @@ TEST(Decode, string)
         ASSERT_EQ(decoder.step(), DecodeState::end);
         ASSERT_TRUE(decoder);
     }
+    { // Long strings with special characters at every offset, to exercise block scanning
+        const std::string plain(100u, 'a');
+        Decoder decoder{};
+        for (u32 offset{0u}; offset < 70u; ++offset)
+        {
+            // Vary the alignment of the string start as well
+            const std::string padding(offset % 7u, ' ');
+
+            const std::string quoted{padding + '"' + plain.substr(0u, offset) + '"'};
+            decoder.load(quoted);
+            ASSERT_EQ(decoder.step(), DecodeState::string);
+            ASSERT_EQ(decoder.string, plain.substr(0u, offset));
+            ASSERT_TRUE(decoder.finished());
+
+            const std::string escaped{padding + '"' + plain.substr(0u, offset) + "\\n" + plain + '"'};
+            decoder.load(escaped);
+            ASSERT_EQ(decoder.step(), DecodeState::string);
+            ASSERT_EQ(decoder.string, plain.substr(0u, offset) + '\n' + plain);
+            ASSERT_TRUE(decoder.finished());
+
+            const std::string control{padding + '"' + plain.substr(0u, offset) + '\x1F' + plain + '"'};
+            ASSERT_TRUE(fails(control.c_str()));
+
+            const std::string unterminated{padding + '"' + plain.substr(0u, offset)};
+            ASSERT_TRUE(fails(unterminated.c_str()));
+        }
+    }
+}
+
+TEST(Decode, zeroCopy)
+{
+    { // Plain strings are viewed in place
+        const std::string qcon{R"({"k": "abc", "key": ""})"};
+        Decoder decoder{qcon};
+        decoder.zeroCopy = true;
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.keyView, "k");
+        ASSERT_EQ(decoder.keyView.data(), qcon.data() + 2);
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.stringView, "abc");
+        ASSERT_EQ(decoder.stringView.data(), qcon.data() + 7);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.keyView, "key");
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.stringView, "");
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Escaped strings fall back to the owned buffer
+        Decoder decoder{R"(["a\tb", "ab\"")"};
+        decoder.zeroCopy = true;
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.stringView, "a\tb");
+        ASSERT_EQ(decoder.stringView.data(), decoder.string.data());
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.stringView, "ab\"");
+        ASSERT_EQ(decoder.stringView.data(), decoder.string.data());
+    }
+    { // Concatenated strings fall back to the owned buffer
+        Decoder decoder{"{\"a\" \"b\": \"abc\" # comment\n \"def\\n\" \"ghi\"}"};
+        decoder.zeroCopy = true;
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.keyView, "ab");
+        ASSERT_EQ(decoder.keyView.data(), decoder.key.data());
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.stringView, "abcdef\nghi");
+        ASSERT_EQ(decoder.stringView.data(), decoder.string.data());
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Views are also set when copying
+        Decoder decoder{R"({"k": "v"})"};
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.key, "k");
+        ASSERT_EQ(decoder.keyView, "k");
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.string, "v");
+        ASSERT_EQ(decoder.stringView, "v");
+    }
+    { // Invalid content is still caught
+        Decoder decoder{"\"abc\x01\""};
+        decoder.zeroCopy = true;
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        decoder.load("\"abc");
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+    }
+    { // Views of owned strings survive a move
+        Decoder decoder{R"("a\tb")"};
+        decoder.zeroCopy = true;
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        Decoder moved{std::move(decoder)};
+        ASSERT_EQ(moved.stringView, "a\tb");
+        ASSERT_EQ(moved.stringView.data(), moved.string.data());
+    }
 }
 
 TEST(Decode, decimal)
@@ -544,6 +679,43 @@ TEST(Decode, decimal)
         ASSERT_TRUE(decoder.positive);
         ASSERT_TRUE(decoder);
     }
+    { // Every length, followed by various characters
+        u64 expected{0u};
+        std::string digits{};
+        for (u64 length{1u}; length <= 20u; ++length)
+        {
+            digits.push_back(char('0' + length % 10u));
+            expected = expected * 10u + length % 10u;
+            for (const std::string_view suffix : {"]"sv, " ]"sv, ",]"sv, "/]"sv, ":]"sv})
+            {
+                const std::string qcon{'[' + digits + std::string{suffix}};
+                Decoder decoder{qcon};
+                ASSERT_EQ(decoder.step(), DecodeState::array);
+                ASSERT_EQ(decoder.step(), DecodeState::integer) << qcon;
+                ASSERT_EQ(u64(decoder.integer), expected) << qcon;
+            }
+        }
+    }
+    { // Overflow at every position relative to a block of eight digits
+        ASSERT_TRUE(fails("18446744073709551616"));
+        ASSERT_TRUE(fails("99999999999999999999"));
+        ASSERT_TRUE(fails("184467440737095516150"));
+        ASSERT_TRUE(fails("000000000000000000000018446744073709551616"));
+        Decoder decoder{"000000000000000000000018446744073709551615"};
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.integer, std::numeric_limits<u64>::max());
+    }
+    { // Digits at the end of a page
+        alignas(4096) static char page[2u * 4096u];
+        for (u64 offset{4096u - 12u}; offset < 4096u; ++offset)
+        {
+            std::memset(page, 0, sizeof(page));
+            std::memcpy(page + offset, "12345678901", 11u);
+            Decoder decoder{page + offset};
+            ASSERT_EQ(decoder.step(), DecodeState::integer);
+            ASSERT_EQ(decoder.integer, 12345678901);
+        }
+    }
     { // Leading zeroes
         Decoder decoder{};
 
@@ -873,6 +1045,84 @@ TEST(Decode, binary)
 
 TEST(Decode, floater)
 {
+    { // Floaters followed by more content, with and without exponents
+        Decoder decoder{"[1.5, 2.5e1,3.5E-1 ,4e+2]"};
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 1.5);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 25.0);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 0.35);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 400.0);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Floaters in a reused decoder and across chunks
+        Decoder decoder{"1.5"};
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        const std::string longer{"[2.5, " + std::string(100u, ' ') + "3.5]"};
+        decoder.load(longer);
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 2.5);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 3.5);
+
+        PushDecoder pushDecoder{};
+        pushDecoder.feed("[1.25, " + std::string(1000u, ' ') + "2");
+        ASSERT_EQ(pushDecoder.step(), DecodeState::array);
+        ASSERT_EQ(pushDecoder.step(), DecodeState::floater);
+        ASSERT_EQ(pushDecoder.floater, 1.25);
+        pushDecoder.feed(".7");
+        pushDecoder.feed("5e1, 3");
+        ASSERT_EQ(pushDecoder.step(), DecodeState::floater);
+        ASSERT_EQ(pushDecoder.floater, 27.5);
+    }
+    { // Tricky cases match `from_chars` exactly
+        for (const std::string_view str : {
+            "9007199254740993.0"sv,      // Halfway, round down to even
+            "9007199254740995.0"sv,      // Halfway, round up to even
+            "1e23"sv,                    // Inexact without extended precision
+            "7.2057594037927933e16"sv,
+            "1.7976931348623157e308"sv,  // Max
+            "2.2250738585072014e-308"sv, // Min normal
+            "2.2250738585072011e-308"sv, // Max subnormal
+            "4.9e-324"sv,                // Min subnormal
+            "123456789012345678901234567890e-10"sv, // More than 19 digits
+            "0.000000000000000000000000000001"sv,
+            "3.14159265358979323846264338327950288"sv})
+        {
+            f64 expected;
+            std::from_chars(str.data(), str.data() + str.size(), expected);
+            Decoder decoder{str};
+            ASSERT_EQ(decoder.step(), DecodeState::floater);
+            ASSERT_EQ(std::bit_cast<u64>(decoder.floater), std::bit_cast<u64>(expected)) << str;
+        }
+    }
+    { // Incomplete exponent
+        ASSERT_TRUE(fails("1e"));
+        ASSERT_TRUE(fails("1.5e+"));
+        ASSERT_TRUE(fails("[1.5e-]"));
+    }
+    { // Integer or floater is only decided after the leading digits
+        Decoder decoder{"[123456789, 123456789.5, 123456789e1, 12345678901234567890123.5, 12345678901234567890e-1]"};
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.integer, 123456789);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 123456789.5);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 1234567890.0);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 12345678901234567890123.5);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.floater, 1234567890123456789.0);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(fails("1."));
+        ASSERT_TRUE(fails("123456789012345678901234."));
+    }
     { // Zero
         Decoder decoder{"0.0"};
         ASSERT_EQ(decoder.step(), DecodeState::floater);
@@ -1657,10 +1907,32 @@ TEST(Decode, noSpace)
 
 TEST(Decode, extraneousSpace)
 {
-    Decoder decoder{" \t\n\r\v{} \t\n\r\v"};
-    ASSERT_EQ(decoder.step(), DecodeState::object);
-    ASSERT_EQ(decoder.step(), DecodeState::end);
-    ASSERT_TRUE(decoder);
+    {
+        Decoder decoder{" \t\n\r\v{} \t\n\r\v"};
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder);
+    }
+    { // Long runs of space ending at every offset, to exercise block scanning
+        Decoder decoder{};
+        for (u32 length{0u}; length < 70u; ++length)
+        {
+            std::string space{};
+            for (u32 i{0u}; i < length; ++i) space.push_back(" \t\n\v\f\r"[i % 6u]);
+
+            const std::string qcon{space + '[' + space + '1' + space + ',' + space + ']' + space};
+            decoder.load(qcon);
+            ASSERT_EQ(decoder.step(), DecodeState::array);
+            ASSERT_EQ(decoder.step(), DecodeState::integer);
+            ASSERT_EQ(decoder.integer, 1);
+            ASSERT_EQ(decoder.step(), DecodeState::end);
+            ASSERT_TRUE(decoder.finished());
+
+            // Non-space characters just outside the space range
+            ASSERT_TRUE(fails((space + "\x08" + space + '1').c_str()));
+            ASSERT_TRUE(fails((space + "1" + space + "\x0E").c_str()));
+        }
+    }
 }
 
 TEST(Decode, trailingComma)
@@ -1757,6 +2029,23 @@ TEST(Decode, comments)
         ASSERT_EQ(decoder.integer, 0);
         ASSERT_TRUE(decoder);
     }
+    { // Long comments ending at every offset, to exercise block scanning
+        Decoder decoder{};
+        for (u32 length{0u}; length < 70u; ++length)
+        {
+            const std::string comment{'#' + std::string(length, 'A')};
+
+            const std::string qcon{comment + '\n' + comment + "\n[" + comment + "\n0" + comment + "\n]" + comment};
+            decoder.load(qcon);
+            ASSERT_EQ(decoder.step(), DecodeState::array);
+            ASSERT_EQ(decoder.step(), DecodeState::integer);
+            ASSERT_EQ(decoder.integer, 0);
+            ASSERT_EQ(decoder.step(), DecodeState::end);
+            ASSERT_TRUE(decoder.finished());
+
+            ASSERT_TRUE(fails(("[0" + comment + "]").c_str()));
+        }
+    }
     { // Comment in string
         Decoder decoder{R"("# AAAAA")"};
         ASSERT_EQ(decoder.step(), DecodeState::string);
@@ -1898,6 +2187,54 @@ TEST(Decode, depth)
     { // 65 nested arrays
         ASSERT_TRUE(fails("[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[true]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]"));
     }
+    { // Beyond 64 levels with a raised max depth, mixing objects and arrays across the spill boundaries
+        const u32 depth{200u};
+        const auto isObject{[](const u32 level) { return level % 3u == 0u; }};
+        std::string qcon{};
+        for (u32 level{0u}; level < depth; ++level)
+        {
+            qcon += isObject(level) ? R"({"k": )" : "[";
+        }
+        qcon += "true";
+        for (u32 level{depth}; level-- > 0u;)
+        {
+            qcon += isObject(level) ? R"(, "s": 1})" : ", 1]";
+        }
+
+        Decoder decoder{qcon};
+        decoder.maxDepth = depth;
+        for (u32 level{0u}; level < depth; ++level)
+        {
+            if (level > 0u && isObject(level - 1u))
+            {
+                ASSERT_EQ(decoder.step(), DecodeState::key);
+            }
+            ASSERT_EQ(decoder.step(), isObject(level) ? DecodeState::object : DecodeState::array);
+        }
+        if (isObject(depth - 1u))
+        {
+            ASSERT_EQ(decoder.step(), DecodeState::key);
+        }
+        ASSERT_EQ(decoder.step(), DecodeState::boolean);
+        for (u32 level{depth}; level-- > 0u;)
+        {
+            if (isObject(level))
+            {
+                ASSERT_EQ(decoder.step(), DecodeState::key);
+                ASSERT_EQ(decoder.key, "s");
+            }
+            ASSERT_EQ(decoder.step(), DecodeState::integer);
+            ASSERT_EQ(decoder.step(), DecodeState::end);
+        }
+        ASSERT_TRUE(decoder.finished());
+
+        // One level too deep
+        decoder.load(qcon);
+        decoder.maxDepth = depth - 1u;
+        while (decoder && !decoder.finished()) decoder.step();
+        ASSERT_FALSE(decoder);
+        ASSERT_EQ(decoder.errorMessage(), "Exceeded max depth of 199");
+    }
 }
 
 TEST(Decode, finished)
@@ -2015,6 +2352,1007 @@ TEST(Decode, finished)
     }
 }
 
+TEST(Decode, bounded)
+{
+    { // Unterminated
+        const char qcon[]{'[', '1', ',', ' ', '"', 'a', '"', ']', 'x'};
+        Decoder decoder{qcon, 8u};
+        ASSERT_EQ(decoder.endPosition(), decoder.position() + 8u);
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.integer, 1);
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.string, "a");
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Truncated
+        const std::string qcon{"[1, 2]"};
+        Decoder decoder{qcon.data(), 5u};
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+    }
+    { // Padded and terminated is decoded in place
+        const std::string qcon{R"("abc")"};
+        Decoder decoder{qcon.data(), qcon.size(), true};
+        ASSERT_EQ(decoder.position(), qcon.data());
+        ASSERT_EQ(decoder.endPosition(), qcon.data() + qcon.size());
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.string, "abc");
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Padded but not terminated is copied
+        const std::string qcon{R"("abc"x)"};
+        Decoder decoder{qcon.data(), 5u, true};
+        ASSERT_NE(decoder.position(), qcon.data());
+        ASSERT_EQ(decoder.endPosition(), decoder.position() + 5u);
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.string, "abc");
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Null terminated has no known end
+        const Decoder decoder{"[]"};
+        ASSERT_EQ(decoder.endPosition(), nullptr);
+    }
+    { // String view
+        Decoder decoder{"{\"k\": 1}"sv};
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+        decoder.load("[]"sv);
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Null characters
+        ASSERT_EQ(Decoder("1\0"sv).step(), DecodeState::error);
+        ASSERT_EQ(Decoder("1\0 2"sv).step(), DecodeState::error);
+        ASSERT_EQ(Decoder("\"a\0\""sv).step(), DecodeState::error);
+        ASSERT_FALSE(Decoder("\0"sv));
+        ASSERT_FALSE(Decoder(""sv));
+    }
+    { // Buffer survives a move
+        Decoder decoder{"[1, 2]"sv};
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        Decoder moved{std::move(decoder)};
+        ASSERT_EQ(moved.step(), DecodeState::integer);
+        ASSERT_EQ(moved.integer, 1);
+        ASSERT_EQ(moved.step(), DecodeState::integer);
+        ASSERT_EQ(moved.integer, 2);
+        ASSERT_EQ(moved.step(), DecodeState::end);
+        ASSERT_TRUE(moved.finished());
+    }
+}
+
+static std::filesystem::path writeTempFile(const std::string_view name, const std::string_view content)
+{
+    const std::filesystem::path path{std::filesystem::temp_directory_path() / name};
+    std::ofstream file{path, std::ios::binary};
+    file.write(content.data(), std::streamsize(content.size()));
+    return path;
+}
+
+TEST(Decode, loadFile)
+{
+    { // Small file
+        const std::filesystem::path path{writeTempFile("qcon-test-small.qcon", "{\"k\": [1, \"v\"]} # comment\n")};
+        Decoder decoder{};
+        decoder.loadFile(path);
+        ASSERT_TRUE(decoder);
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.key, "k");
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.string, "v");
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+        std::filesystem::remove(path);
+    }
+    { // File sizes around page boundaries
+        for (const u64 size : {4095u, 4096u, 4097u, 8192u})
+        {
+            const std::string qcon{'"' + std::string(size - 2u, 'a') + '"'};
+            const std::filesystem::path path{writeTempFile("qcon-test-page.qcon", qcon)};
+            Decoder decoder{};
+            decoder.loadFile(path);
+            ASSERT_EQ(decoder.step(), DecodeState::string);
+            ASSERT_EQ(decoder.string.size(), size - 2u);
+            ASSERT_TRUE(decoder.finished());
+            std::filesystem::remove(path);
+        }
+    }
+    { // Truncated file
+        const std::filesystem::path path{writeTempFile("qcon-test-truncated.qcon", "[1, ")};
+        Decoder decoder{};
+        decoder.loadFile(path);
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        std::filesystem::remove(path);
+    }
+    { // Empty file
+        const std::filesystem::path path{writeTempFile("qcon-test-empty.qcon", "")};
+        Decoder decoder{};
+        decoder.loadFile(path);
+        ASSERT_FALSE(decoder);
+        ASSERT_EQ(decoder.errorMessage(), "Expected value");
+        std::filesystem::remove(path);
+    }
+    { // Missing file
+        Decoder decoder{};
+        decoder.loadFile(std::filesystem::temp_directory_path() / "qcon-test-missing.qcon");
+        ASSERT_FALSE(decoder);
+        ASSERT_EQ(decoder.errorMessage(), "Failed to open file");
+    }
+    { // Mapping survives a move and is released by the next load
+        const std::filesystem::path path{writeTempFile("qcon-test-move.qcon", "[1, 2]")};
+        Decoder decoder{};
+        decoder.loadFile(path);
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        Decoder moved{std::move(decoder)};
+        ASSERT_EQ(moved.step(), DecodeState::integer);
+        ASSERT_EQ(moved.step(), DecodeState::integer);
+        ASSERT_EQ(moved.step(), DecodeState::end);
+        ASSERT_TRUE(moved.finished());
+        moved.load("3");
+        ASSERT_EQ(moved.step(), DecodeState::integer);
+        std::filesystem::remove(path);
+    }
+}
+
+template <typename D>
+static std::string describeStep(D & decoder)
+{
+    const DecodeState state{decoder.step()};
+    std::ostringstream ss{};
+    ss << state;
+    switch (state)
+    {
+        case DecodeState::key: ss << ' ' << decoder.key; break;
+        case DecodeState::string: ss << ' ' << decoder.string; break;
+        case DecodeState::integer: ss << ' ' << decoder.integer; break;
+        case DecodeState::floater: ss << ' ' << decoder.floater; break;
+        case DecodeState::boolean: ss << ' ' << decoder.boolean; break;
+        case DecodeState::time: ss << ' ' << int(decoder.time.minute); break;
+        case DecodeState::datetime: ss << ' ' << int(decoder.datetime.date.day) << ' ' << int(decoder.datetime.time.minute); break;
+        default: break;
+    }
+    return ss.str();
+}
+
+static std::vector<std::string> describeAll(const std::string & qcon)
+{
+    std::vector<std::string> steps{};
+    Decoder decoder{qcon};
+    while (decoder && !decoder.finished())
+    {
+        steps.push_back(describeStep(decoder));
+    }
+    return steps;
+}
+
+static std::vector<std::string> describeAllPushed(const std::string & qcon, const u64 chunkSize)
+{
+    std::vector<std::string> steps{};
+    PushDecoder decoder{};
+    for (u64 i{0u}; i < qcon.size(); i += chunkSize)
+    {
+        decoder.feed(std::string_view{qcon}.substr(i, chunkSize));
+        while (decoder.available())
+        {
+            steps.push_back(describeStep(decoder));
+        }
+    }
+    decoder.close();
+    while (decoder.available())
+    {
+        steps.push_back(describeStep(decoder));
+    }
+    return steps;
+}
+
+TEST(Decode, push)
+{
+    { // Every chunk size yields the same steps
+        const std::string qcon{
+            "# Leading comment, with [structural] {characters}: \"\n"
+            "{\n"
+            "    \"a\\\"b\": \"multi\" # comment \"\n"
+            "        \"part\\n\",\n"
+            "    \"list\": [1, -2, 0x1F, 3.25e2, true, null, \"\", [], {}],\n"
+            "    \"time\": T12:34:56.789,\n"
+            "    \"datetime\": D2023-04-05T06:07:08Z,\n"
+            "    \"nested\": {\"x\": [[{\"y\": \"[,]{:}\"},],], \"z\": 0b101},\n"
+            "}\n"
+            "# Trailing comment"};
+        const std::vector<std::string> expected{describeAll(qcon)};
+        ASSERT_EQ(expected.back(), "end");
+        for (u64 chunkSize{1u}; chunkSize <= qcon.size(); ++chunkSize)
+        {
+            ASSERT_EQ(describeAllPushed(qcon, chunkSize), expected) << "Chunk size " << chunkSize;
+        }
+    }
+    { // Root values are only available once closed
+        PushDecoder decoder{};
+        decoder.feed("12");
+        ASSERT_FALSE(decoder.available());
+        decoder.feed("34");
+        ASSERT_FALSE(decoder.available());
+        decoder.close();
+        ASSERT_TRUE(decoder.available());
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.integer, 1234);
+        ASSERT_TRUE(decoder.finished());
+        ASSERT_FALSE(decoder.available());
+    }
+    { // Units are available as soon as they are complete
+        PushDecoder decoder{};
+        decoder.feed("[\"ab");
+        ASSERT_TRUE(decoder.available());
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_FALSE(decoder.available());
+        decoder.feed("c\" ");
+        ASSERT_FALSE(decoder.available());
+        decoder.feed("\"def\", 1");
+        ASSERT_TRUE(decoder.available());
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.string, "abcdef");
+        ASSERT_FALSE(decoder.available());
+        decoder.feed("]");
+        ASSERT_FALSE(decoder.available());
+        decoder.close();
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Errors
+        PushDecoder decoder{};
+        ASSERT_TRUE(decoder);
+        decoder.feed("[1, 2");
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_FALSE(decoder.available());
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_FALSE(decoder);
+    }
+    { // Truncated
+        PushDecoder decoder{};
+        decoder.feed("[1, 2");
+        decoder.close();
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_TRUE(decoder.available());
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_FALSE(decoder.available());
+    }
+    { // Extraneous content
+        PushDecoder decoder{};
+        decoder.feed("[] []");
+        decoder.close();
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+    }
+    { // Null character
+        PushDecoder decoder{};
+        decoder.feed("1\0"sv);
+        decoder.close();
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+    }
+    { // Empty
+        PushDecoder decoder{};
+        decoder.feed(" # nothing");
+        decoder.close();
+        ASSERT_FALSE(decoder);
+        ASSERT_FALSE(decoder.available());
+    }
+    { // Feeding after close
+        PushDecoder decoder{};
+        decoder.feed("[");
+        decoder.close();
+        decoder.feed("]");
+        ASSERT_FALSE(decoder);
+    }
+}
+
+TEST(Decode, skip)
+{
+    { // Skip containers whose strings and comments contain structural characters
+        Decoder decoder{R"({
+            "a": {"b": [1, "]}", "\"]", {"c": "\\"}], # ]}
+                "d": "{[" "#"},
+            "e": [[], {}, "x"],
+            "f": 2
+        })"};
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.key, "a");
+        ASSERT_EQ(decoder.skip(), DecodeState::skipped);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.key, "e");
+        ASSERT_EQ(decoder.skip(), DecodeState::skipped);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.key, "f");
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.integer, 2);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Skip every kind of value
+        Decoder decoder{R"([1, -2.5e3, 0x1F, "a" # Comment
+            "b", true, null, nan, -inf, D2020-01-01T00:00:00Z, T12:30:00, D2020-01-01, {}, [], 3])"};
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        for (u32 i{0u}; i < 13u; ++i) ASSERT_EQ(decoder.skip(), DecodeState::skipped);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.integer, 3);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Skip root
+        Decoder decoder{R"( {"a": [1, 2, 3]} # Comment)"};
+        ASSERT_EQ(decoder.skip(), DecodeState::skipped);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Skip with stream operators
+        Decoder decoder{R"({"a": [1, 2], "b": 3})"};
+        s64 v;
+        std::string k;
+        ASSERT_TRUE(decoder >> object >> k);
+        ASSERT_EQ(decoder.skip(), DecodeState::skipped);
+        ASSERT_TRUE(decoder >> k >> v >> end);
+        ASSERT_EQ(v, 3);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Errors
+        Decoder decoder{R"({"a": 1})"};
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.skip(), DecodeState::error); // Key not yet decoded
+
+        decoder.load(R"([])");
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.skip(), DecodeState::error); // No value
+
+        decoder.load(R"([[1, 2])");
+        ASSERT_EQ(decoder.skip(), DecodeState::error); // Unterminated container
+
+        decoder.load(R"(["a, 1])");
+        ASSERT_EQ(decoder.skip(), DecodeState::error); // Unterminated string
+
+        decoder.load(R"([1] 2)");
+        ASSERT_EQ(decoder.skip(), DecodeState::error); // Extraneous root content
+    }
+}
+
+// Straightforward character by character equivalent of `StructuralIndex`
+static std::vector<u32> referenceStructuralIndex(const std::string_view qcon)
+{
+    // Any odd run of backslashes escapes the following character
+    std::vector<bool> escaped(qcon.size() + 1u, false);
+    for (u64 i{0u}; i < qcon.size(); ++i)
+    {
+        if (qcon[i] == '\\' && !escaped[i]) escaped[i + 1u] = true;
+    }
+
+    std::vector<u32> offsets{};
+    enum { space, string, comment } lexeme{space};
+    bool afterString{false};
+    bool inScalar{false};
+    bool afterPlainScalar{false}; // Whether the previous character was part of a scalar and not a colon
+    for (u64 i{0u}; i < qcon.size(); ++i)
+    {
+        const char c{qcon[i]};
+        const bool quote{c == '"' && !escaped[i]};
+        const bool wasAfterPlainScalar{afterPlainScalar};
+        afterPlainScalar = false;
+        if (lexeme == string)
+        {
+            if (quote)
+            {
+                lexeme = space;
+                afterString = true;
+            }
+        }
+        else if (lexeme == comment)
+        {
+            if (c == '\n') lexeme = space;
+        }
+        else if (c == '#')
+        {
+            lexeme = comment;
+            inScalar = false;
+        }
+        else if (quote)
+        {
+            if (!afterString) offsets.push_back(u32(i));
+            lexeme = string;
+            inScalar = false;
+        }
+        else if (c == ':' && wasAfterPlainScalar)
+        {
+            // Part of a time or timezone
+        }
+        else if (std::strchr("{}[]:,", c))
+        {
+            offsets.push_back(u32(i));
+            afterString = false;
+            inScalar = false;
+        }
+        else if (std::strchr(" \t\n\v\f\r", c))
+        {
+            inScalar = false;
+        }
+        else
+        {
+            if (!inScalar) offsets.push_back(u32(i));
+            afterString = false;
+            inScalar = true;
+            afterPlainScalar = true;
+        }
+    }
+    return offsets;
+}
+
+static std::string structuralCharacters(const std::string_view qcon)
+{
+    const StructuralIndex index{qcon};
+    std::string characters{};
+    for (const u32 offset : index.offsets()) characters += qcon[offset];
+    return characters;
+}
+
+TEST(Decode, errors)
+{
+    { // No error
+        Decoder decoder{R"([1, 2])"};
+        ASSERT_EQ(decoder.error(), ErrorCode::none);
+        ASSERT_EQ(decoder.errorMessage(), ""s);
+    }
+    { // Code, offset, and message
+        Decoder decoder{R"({"a": 1, "b": tru})"};
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_EQ(decoder.error(), ErrorCode::unknownValue);
+        ASSERT_EQ(decoder.errorOffset(), 14u);
+        ASSERT_EQ(decoder.errorMessage(), "Unknown value"s);
+    }
+    { // Messages with details
+        Decoder decoder{R"({"a" 1})"};
+        decoder.step();
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_EQ(decoder.error(), ErrorCode::expectedCharacter);
+        ASSERT_EQ(decoder.errorOffset(), 5u);
+        ASSERT_EQ(decoder.errorMessage(), "Expected `:`"s);
+
+        decoder.load(R"("\u12")");
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_EQ(decoder.error(), ErrorCode::expectedHexDigits);
+        ASSERT_EQ(decoder.errorMessage(), "Expected 4 hex digits"s);
+
+        decoder.load(R"(nul)");
+        decoder >> nullptr;
+        ASSERT_FALSE(decoder);
+        ASSERT_EQ(decoder.error(), ErrorCode::expectedCharacters);
+        ASSERT_EQ(decoder.errorMessage(), "Expected `null`"s);
+    }
+    { // Speculative decode
+        Decoder decoder{R"(1.5)"};
+        s64 v;
+        decoder >> v;
+        ASSERT_FALSE(decoder);
+        ASSERT_EQ(decoder.error(), ErrorCode::expectedInteger);
+    }
+    { // Loading clears the error
+        Decoder decoder{R"(])"};
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_NE(decoder.error(), ErrorCode::none);
+        decoder.load(R"(1)");
+        ASSERT_EQ(decoder.error(), ErrorCode::none);
+    }
+    { // Move
+        Decoder decoder{R"(])"};
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        const ErrorCode error{decoder.error()};
+        const std::string message{decoder.errorMessage()};
+        Decoder moved{std::move(decoder)};
+        ASSERT_EQ(moved.error(), error);
+        ASSERT_EQ(moved.errorMessage(), message);
+    }
+    { // Push decoder offsets include discarded input
+        PushDecoder decoder{};
+        decoder.feed(R"([1, 2, )"sv);
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        decoder.feed(R"(3, x])"sv);
+        decoder.close();
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_EQ(decoder.error(), ErrorCode::unknownValue);
+        ASSERT_EQ(decoder.errorOffset(), 10u);
+    }
+}
+
+TEST(Decode, peekType)
+{
+    { // Values
+        ASSERT_EQ(Decoder{R"({})"}.peekType(), DecodeState::object);
+        ASSERT_EQ(Decoder{R"([])"}.peekType(), DecodeState::array);
+        ASSERT_EQ(Decoder{R"("abc")"}.peekType(), DecodeState::string);
+        ASSERT_EQ(Decoder{R"(123)"}.peekType(), DecodeState::integer);
+        ASSERT_EQ(Decoder{R"(-123)"}.peekType(), DecodeState::integer);
+        ASSERT_EQ(Decoder{R"(0x1F)"}.peekType(), DecodeState::integer);
+        ASSERT_EQ(Decoder{R"(0b1e1)"}.peekType(), DecodeState::integer);
+        ASSERT_EQ(Decoder{R"(12.5)"}.peekType(), DecodeState::floater);
+        ASSERT_EQ(Decoder{R"(12e5)"}.peekType(), DecodeState::floater);
+        ASSERT_EQ(Decoder{R"(+1E5)"}.peekType(), DecodeState::floater);
+        ASSERT_EQ(Decoder{R"(inf)"}.peekType(), DecodeState::floater);
+        ASSERT_EQ(Decoder{R"(-inf)"}.peekType(), DecodeState::floater);
+        ASSERT_EQ(Decoder{R"(nan)"}.peekType(), DecodeState::floater);
+        ASSERT_EQ(Decoder{R"(+nan)"}.peekType(), DecodeState::floater);
+        ASSERT_EQ(Decoder{R"(true)"}.peekType(), DecodeState::boolean);
+        ASSERT_EQ(Decoder{R"(false)"}.peekType(), DecodeState::boolean);
+        ASSERT_EQ(Decoder{R"(D2000-01-01)"}.peekType(), DecodeState::date);
+        ASSERT_EQ(Decoder{R"(D2000-01-01T00:00:00)"}.peekType(), DecodeState::datetime);
+        ASSERT_EQ(Decoder{R"(D2000)"}.peekType(), DecodeState::date);
+        ASSERT_EQ(Decoder{R"(T12:00:00)"}.peekType(), DecodeState::time);
+        ASSERT_EQ(Decoder{R"(null)"}.peekType(), DecodeState::null);
+        ASSERT_EQ(Decoder{R"(abc)"}.peekType(), DecodeState::error);
+        ASSERT_EQ(Decoder{R"(-abc)"}.peekType(), DecodeState::error);
+    }
+    { // Structure
+        Decoder decoder{R"({"a": [1, 1.0], "b": {}})"};
+        ASSERT_EQ(decoder.peekType(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.peekType(), DecodeState::key);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.peekType(), DecodeState::array);
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.peekType(), DecodeState::integer);
+        ASSERT_EQ(decoder.peekType(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.peekType(), DecodeState::floater);
+        ASSERT_EQ(decoder.step(), DecodeState::floater);
+        ASSERT_EQ(decoder.peekType(), DecodeState::end);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.peekType(), DecodeState::end);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_EQ(decoder.peekType(), DecodeState::end);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+        ASSERT_EQ(decoder.peekType(), DecodeState::error);
+        ASSERT_TRUE(decoder);
+    }
+    { // Error
+        Decoder decoder{R"(])"};
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_EQ(decoder.peekType(), DecodeState::error);
+    }
+}
+
+TEST(Decode, tryRead)
+{
+    { // Mismatch leaves the decoder untouched
+        Decoder decoder{R"(["abc", 1.5, 300, {}])"};
+        decoder >> qcon::array;
+        s64 integer;
+        f64 floater;
+        std::string str;
+        u8 small;
+        u16 medium;
+        ASSERT_FALSE(decoder.tryRead(integer));
+        ASSERT_TRUE(decoder);
+        ASSERT_EQ(decoder.error(), ErrorCode::expectedInteger);
+        ASSERT_FALSE(decoder.tryRead(floater));
+        ASSERT_TRUE(decoder.tryRead(str));
+        ASSERT_EQ(str, "abc"s);
+        ASSERT_FALSE(decoder.tryRead(integer));
+        ASSERT_TRUE(decoder.tryRead(floater));
+        ASSERT_EQ(floater, 1.5);
+        ASSERT_FALSE(decoder.tryRead(small));
+        ASSERT_TRUE(decoder);
+        ASSERT_TRUE(decoder.tryRead(medium));
+        ASSERT_EQ(medium, 300u);
+        ASSERT_FALSE(decoder.tryRead(qcon::array));
+        ASSERT_TRUE(decoder.tryRead(qcon::object));
+        ASSERT_FALSE(decoder.tryRead(integer));
+        ASSERT_TRUE(decoder.tryRead(qcon::end));
+        ASSERT_TRUE(decoder.tryRead(qcon::end));
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Malformed values are left for the next decode
+        Decoder decoder{R"([tru])"};
+        decoder >> qcon::array;
+        bool boolean;
+        ASSERT_FALSE(decoder.tryRead(boolean));
+        ASSERT_TRUE(decoder);
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+    }
+    { // Existing errors are kept
+        Decoder decoder{R"(])"};
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        s64 integer;
+        ASSERT_FALSE(decoder.tryRead(integer));
+        ASSERT_FALSE(decoder);
+    }
+}
+
+TEST(Decode, binding)
+{
+    { // Nested structs, vectors, dates, and times
+        Decoder decoder{R"({"Date": D2000-01-02, "Inner": [{"Vals": [1, 2], "Name": "abc"}, {"Name": "def"}], "Time": T08:30:00, "Flag": true})"};
+        BoundOuter v{};
+        ASSERT_TRUE(decoder >> v);
+        ASSERT_TRUE(decoder.finished());
+        ASSERT_EQ(v.inner.size(), 2u);
+        ASSERT_EQ(v.inner[0].name, "abc");
+        ASSERT_EQ(v.inner[0].vals, (std::vector<s32>{1, 2}));
+        ASSERT_EQ(v.inner[1].name, "def");
+        ASSERT_TRUE(v.inner[1].vals.empty());
+        ASSERT_EQ(v.date, (std::chrono::year_month_day{std::chrono::year{2000}, std::chrono::month{1}, std::chrono::day{2}}));
+        ASSERT_EQ(v.time, std::chrono::minutes{8 * 60 + 30});
+        ASSERT_TRUE(v.flag);
+    }
+    { // Unknown keys are skipped and missing keys are left alone
+        Decoder decoder{R"({"Nam": 1, "Names": [2], "Name": "abc", "name": {"Vals": 3}})"};
+        BoundVal v{.name = "", .vals = {4}};
+        ASSERT_TRUE(decoder >> v);
+        ASSERT_TRUE(decoder.finished());
+        ASSERT_EQ(v.name, "abc");
+        ASSERT_EQ(v.vals, std::vector<s32>{4});
+    }
+    { // Every key of many similar keys is matched
+        Decoder decoder{R"({"f": 16, "ede": 15, "ed": 14, "e": 13, "dcd": 12, "dc": 11, "d": 10, "cbc": 9, "cb": 8, "c": 7, "bab": 6, "ba": 5, "b": 4, "abc": 3, "ab": 2, "a": 1, "": 0, "abcd": 0})"};
+        BoundMany v{};
+        ASSERT_TRUE(decoder >> v);
+        ASSERT_EQ(v.a, 1); ASSERT_EQ(v.ab, 2); ASSERT_EQ(v.abc, 3); ASSERT_EQ(v.b, 4);
+        ASSERT_EQ(v.ba, 5); ASSERT_EQ(v.bab, 6); ASSERT_EQ(v.c, 7); ASSERT_EQ(v.cb, 8);
+        ASSERT_EQ(v.cbc, 9); ASSERT_EQ(v.d, 10); ASSERT_EQ(v.dc, 11); ASSERT_EQ(v.dcd, 12);
+        ASSERT_EQ(v.e, 13); ASSERT_EQ(v.ed, 14); ASSERT_EQ(v.ede, 15); ASSERT_EQ(v.f, 16);
+    }
+    { // Wrong types
+        BoundVal v{};
+        Decoder decoder{R"([])"};
+        ASSERT_FALSE(decoder >> v);
+        decoder.load(R"({"Name": 1})");
+        ASSERT_FALSE(decoder >> v);
+        decoder.load(R"({"Vals": [1, "a"]})");
+        ASSERT_FALSE(decoder >> v);
+        decoder.load(R"({"Vals": [1, 2})");
+        ASSERT_FALSE(decoder >> v);
+    }
+}
+
+TEST(Decode, splitElements)
+{
+    { // Runs start at elements, regardless of strings, comments, and nesting
+        const std::string qcon{R"([1, "a, b", # c, d
+            [2, 3], {"e": ",", "f": [4, 5]}, 6,])"};
+        Decoder decoder{qcon};
+        decoder >> qcon::array;
+        const char * const b{&qcon[qcon.find('"')]};
+        const char * const c{&qcon[qcon.find("[2")]};
+        const char * const d{&qcon[qcon.find('{')]};
+        const char * const e{&qcon[qcon.find('6')]};
+        ASSERT_EQ(decoder.splitElements(0u), (std::vector<const char *>{&qcon[1], b, c, d, e}));
+        ASSERT_EQ(decoder.splitElements(5u), (std::vector<const char *>{&qcon[1], c, d, e}));
+        ASSERT_EQ(decoder.splitElements(30u), (std::vector<const char *>{&qcon[1], d}));
+        ASSERT_EQ(decoder.splitElements(1000u), (std::vector<const char *>{&qcon[1]}));
+        ASSERT_EQ(decoder.position(), &qcon[1]);
+    }
+    { // Seeking
+        const std::string qcon{R"([1, [2, 3], {"a": 4}, 5])"};
+        Decoder decoder{qcon};
+        decoder >> qcon::array;
+        const std::vector<const char *> runStarts{decoder.splitElements(0u)};
+        ASSERT_EQ(runStarts.size(), 4u);
+        decoder.seekElement(runStarts[2]);
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        decoder.seekElement(runStarts[3]);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.integer, 5);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.finished());
+    }
+    { // Nothing to split
+        Decoder decoder{R"([])"};
+        ASSERT_TRUE(decoder.splitElements(0u).empty());
+        decoder >> qcon::array;
+        ASSERT_TRUE(decoder.splitElements(0u).empty());
+        decoder.load(R"({"a": 1})");
+        decoder >> qcon::object;
+        ASSERT_TRUE(decoder.splitElements(0u).empty());
+        decoder.seekElement(decoder.position());
+        ASSERT_FALSE(decoder);
+    }
+    { // Larger than one piece of the index
+        std::string qcon{"[\"a\""};
+        for (u64 i{0u}; i < 20000u; ++i) qcon += ", [\"],\", 2]";
+        qcon += "]";
+        Decoder decoder{qcon};
+        decoder >> qcon::array;
+        const std::vector<const char *> runStarts{decoder.splitElements(50000u)};
+        ASSERT_EQ(runStarts.size(), 5u);
+        for (u64 i{1u}; i < runStarts.size(); ++i)
+        {
+            ASSERT_GE(u64(runStarts[i] - runStarts[i - 1u]), 50000u);
+            ASSERT_EQ(runStarts[i][0], '[');
+            ASSERT_EQ(runStarts[i][-2], ',');
+        }
+    }
+}
+
+TEST(Decode, documentStream)
+{
+    { // Consecutive root values of any kind
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load(R"({"a": 1}
+            [2, 3] # Comment
+            "b" "c"
+            4 true{}null)");
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::key);
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_FALSE(decoder.finished());
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        decoder.skip();
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.integer, 3);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.string, "b");
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::string);
+        ASSERT_EQ(decoder.string, "c");
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.integer, 4);
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::boolean);
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::object);
+        ASSERT_EQ(decoder.step(), DecodeState::end);
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::null);
+        ASSERT_TRUE(decoder.finished());
+        ASSERT_FALSE(decoder.nextDocument());
+        ASSERT_TRUE(decoder);
+    }
+    { // Empty stream
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load("  # Comment\n");
+        ASSERT_TRUE(decoder);
+        ASSERT_FALSE(decoder.nextDocument());
+        ASSERT_TRUE(decoder);
+    }
+    { // Only one root value without stream
+        Decoder decoder{R"(1 2)"};
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_EQ(decoder.error(), ErrorCode::extraneousRootContent);
+        ASSERT_FALSE(decoder.nextDocument());
+    }
+    { // Must finish the current document first
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load(R"([1, 2] [3])");
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_FALSE(decoder.nextDocument());
+        ASSERT_EQ(decoder.error(), ErrorCode::unfinishedDocument);
+    }
+    { // Multiple root values within a document
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load(R"(1 2)");
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::integer);
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_EQ(decoder.error(), ErrorCode::multipleRootValues);
+    }
+    { // Early null character
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load(std::string_view{"1\0 2", 4u});
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::error);
+        ASSERT_EQ(decoder.error(), ErrorCode::extraneousRootContent);
+        ASSERT_FALSE(decoder.nextDocument());
+    }
+    { // Splitting and seeking
+        const std::string qcon{R"({"a": "} {"} 1 "b"
+            [2, # ] [
+            3]{}true)"};
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load(qcon);
+        const char * const one{&qcon[qcon.find('1')]};
+        const char * const b{&qcon[qcon.find("\"b")]};
+        const char * const two{&qcon[qcon.find("[2")]};
+        const char * const empty{&qcon[qcon.find("{}")]};
+        const char * const t{&qcon[qcon.find("true")]};
+        ASSERT_EQ(decoder.splitDocuments(0u), (std::vector<const char *>{&qcon[0], one, b, two, empty, t}));
+        ASSERT_EQ(decoder.splitDocuments(14u), (std::vector<const char *>{&qcon[0], b, two, empty}));
+        ASSERT_EQ(decoder.splitDocuments(1000u), (std::vector<const char *>{&qcon[0]}));
+        ASSERT_EQ(decoder.position(), &qcon[0]);
+        decoder.seekDocument(two);
+        ASSERT_TRUE(decoder.nextDocument());
+        ASSERT_EQ(decoder.step(), DecodeState::array);
+        ASSERT_EQ(decoder.splitDocuments(0u), std::vector<const char *>{});
+        decoder.seekDocument(two);
+        ASSERT_FALSE(decoder);
+        ASSERT_EQ(decoder.error(), ErrorCode::unfinishedDocument);
+    }
+    { // Adjacent root strings are separate documents
+        const std::string qcon{R"("a" "b"#c
+            "c""d")"};
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.load(qcon);
+        const char * const b{&qcon[qcon.find("\"b")]};
+        const char * const c{&qcon[qcon.find("\"c")]};
+        const char * const d{&qcon[qcon.find("\"d")]};
+        ASSERT_EQ(decoder.splitDocuments(0u), (std::vector<const char *>{&qcon[0], b, c, d}));
+        ASSERT_EQ(decoder.splitDocuments(5u), (std::vector<const char *>{&qcon[0], c}));
+    }
+    { // Missing file
+        Decoder decoder{};
+        decoder.documentStream = true;
+        decoder.loadFile(std::filesystem::temp_directory_path() / "qcon-test-missing.qcon");
+        ASSERT_FALSE(decoder);
+        ASSERT_EQ(decoder.error(), ErrorCode::failedToOpenFile);
+        ASSERT_FALSE(decoder.nextDocument());
+    }
+}
+
+TEST(Decode, structuralIndex)
+{
+    { // Basic
+        ASSERT_EQ(structuralCharacters(R"({"a": [1, -2.5, true], "b": {}})"), R"({":[1,-,t],":{}})");
+        ASSERT_EQ(structuralCharacters(R"([1,2,D2020-01-01T00:00:00+01:00, T12:30:00])"), R"([1,2,D,T])");
+        ASSERT_EQ(structuralCharacters(R"({"a":T12:30:00})"), R"({":T})");
+        ASSERT_EQ(structuralCharacters(""), "");
+    }
+    { // Strings
+        ASSERT_EQ(structuralCharacters(R"(["{[:,]}", "\"]", "\\", "#"])"), R"([",",","])");
+        ASSERT_EQ(structuralCharacters(R"(["a" "b", "c"
+            # Comment
+            "d"])"), R"([","])");
+    }
+    { // Comments
+        ASSERT_EQ(structuralCharacters("[1, # \"]{\n2] # ["), "[1,2]");
+        ASSERT_EQ(structuralCharacters("#\n#\n[]"), "[]");
+    }
+    { // Unterminated string
+        ASSERT_FALSE(StructuralIndex{R"(["a"])"}.unterminatedString());
+        ASSERT_TRUE(StructuralIndex{R"(["a])"}.unterminatedString());
+    }
+    { // Offsets of a multi-block document
+        const std::string qcon{"[" + std::string(100u, ' ') + "\"" + std::string(100u, 'a') + "\", 1]"};
+        const StructuralIndex index{qcon};
+        ASSERT_EQ(index.offsets(), (std::vector<u32>{0u, 101u, 203u, 205u, 206u}));
+    }
+    { // Matches reference for random content, which is mostly invalid QCON, across block boundaries
+        std::mt19937 random{12345u};
+        const std::string_view alphabet{"{}[]::,\"\"\"\\\\##\n  a1"};
+        StructuralIndex index{};
+        for (u32 i{0u}; i < 20000u; ++i)
+        {
+            std::string qcon(random() % 300u, ' ');
+            for (char & c : qcon) c = alphabet[random() % alphabet.size()];
+            const std::vector<u32> reference{referenceStructuralIndex(qcon)};
+            ASSERT_TRUE(index.build(qcon));
+            ASSERT_EQ(index.offsets(), reference) << qcon;
+
+            // Same when indexed in pieces
+            const u64 pieceLength{64u * (1u + random() % 2u)};
+            std::vector<u32> offsets{};
+            for (u64 start{0u}; start == 0u || start < qcon.size(); start += pieceLength)
+            {
+                const std::string_view piece{std::string_view{qcon}.substr(start, pieceLength)};
+                ASSERT_TRUE(start ? index.buildNext(piece) : index.build(piece));
+                for (const u32 offset : index.offsets()) offsets.push_back(u32(start + offset));
+            }
+            ASSERT_EQ(offsets, reference) << qcon;
+        }
+    }
+}
+
+TEST(Decode, onDemand)
+{
+    const std::string qcon{R"({
+        "name": "primary", # Comment with a } and a ]
+        "servers": [
+            {"host": "a", "port": 80, "tags": ["x", "y"]},
+            {"host": "b\"}", "port": 81},
+            {"host": "c", "port": 82, "started": D2024-01-02T03:04:05Z},
+            {"host": "d", "port": 65535, "ratio": 0.25, "enabled": true, "backup": null}
+        ],
+        "escaped\tkey": "con" "cat",
+        "empty": {},
+    })"};
+
+    { // Navigation
+        OnDemand doc{qcon};
+        ASSERT_EQ(doc["servers"][3]["port"].get<u64>(), 65535u);
+        ASSERT_EQ(doc["servers"][1]["host"].get<std::string>(), "b\"}"s);
+        ASSERT_EQ(doc["servers"][0]["tags"][1].get<std::string_view>(), "y"sv);
+        ASSERT_EQ(doc["servers"][3]["ratio"].get<f64>(), 0.25);
+        ASSERT_EQ(doc["servers"][3]["enabled"].get<bool>(), true);
+        ASSERT_TRUE(doc["servers"][3]["backup"].get<nullptr_t>());
+        ASSERT_EQ(doc["servers"][2]["started"].get<Datetime>()->time.hour, 3u);
+        ASSERT_EQ(doc["escaped\tkey"].get<std::string>(), "concat"s);
+        ASSERT_EQ(doc["name"].get<std::string_view>(), "primary"sv);
+    }
+    { // Values may be reused and navigated in any order
+        OnDemand doc{qcon};
+        const OnDemandValue servers{doc["servers"]};
+        ASSERT_TRUE(servers);
+        for (u64 i{4u}; i > 0u; --i)
+        {
+            ASSERT_EQ(servers[i - 1u]["host"].get<char>(), i == 2u ? std::nullopt : std::optional<char>{char('a' + i - 1u)});
+        }
+        ASSERT_EQ(servers[2]["port"].get<u8>(), 82u);
+    }
+    { // Missing
+        OnDemand doc{qcon};
+        ASSERT_FALSE(doc["nope"]);
+        ASSERT_EQ(doc.errorMessage(), "Missing key"sv);
+        ASSERT_FALSE(doc["empty"]["a"]);
+        ASSERT_EQ(doc.errorMessage(), "Missing key"sv);
+        ASSERT_FALSE(doc["servers"][4]);
+        ASSERT_EQ(doc.errorMessage(), "Index out of range"sv);
+        ASSERT_FALSE(doc["name"]["a"]);
+        ASSERT_EQ(doc.errorMessage(), "Expected object"sv);
+        ASSERT_FALSE(doc["name"][0]);
+        ASSERT_EQ(doc.errorMessage(), "Expected array"sv);
+        ASSERT_FALSE(doc["nope"]["a"][0].get<s64>());
+        ASSERT_TRUE(doc["name"]);
+    }
+    { // Wrong type
+        OnDemand doc{qcon};
+        ASSERT_FALSE(doc["name"].get<s64>());
+        ASSERT_FALSE(doc["servers"][0]["port"].get<std::string>());
+        ASSERT_FALSE(doc["servers"][3]["port"].get<u8>());
+        ASSERT_EQ(doc["servers"][3]["port"].get<u16>(), 65535u);
+    }
+    { // Scalar root
+        OnDemand doc{"  # Comment\n  123  "};
+        ASSERT_EQ(doc.root().get<s64>(), 123);
+        ASSERT_FALSE(doc["a"]);
+    }
+    { // Bounded
+        OnDemand doc{R"({"a": [1, 2, 3]}xyz)"sv.substr(0u, 16u)};
+        ASSERT_EQ(doc["a"][2].get<s64>(), 3);
+    }
+    { // Invalid
+        ASSERT_FALSE(OnDemand{""}.root());
+        ASSERT_FALSE(OnDemand{R"({"a": 1 "b": 2})"}["b"]);
+        ASSERT_FALSE(OnDemand{R"({"a": [1, 2)"}["b"]);
+        ASSERT_FALSE(OnDemand{R"({"a" 1})"}["a"]);
+        ASSERT_FALSE(OnDemand{R"([1, 2)"}[2]);
+    }
+}
+
 TEST(Decode, streamObject)
 {
     Decoder decoder;
@@ -2263,6 +3601,27 @@ TEST(Decode, streamString)
     decoder.load(R"("", "")");
     ASSERT_FALSE(decoder >> v1);
 
+    // String views
+    std::string_view view1;
+    std::string_view view2;
+    decoder.zeroCopy = true;
+    const std::string qcon{R"({"k1": "v1", "k\t2": "v\t2"})"};
+    decoder.load(qcon);
+    ASSERT_TRUE(decoder >> object >> view1);
+    ASSERT_EQ(view1, "k1");
+    ASSERT_EQ(view1.data(), qcon.data() + 2);
+    ASSERT_TRUE(decoder >> view2);
+    ASSERT_EQ(view2, "v1");
+    ASSERT_EQ(view2.data(), qcon.data() + 8);
+    ASSERT_TRUE(decoder >> view1 >> view2);
+    ASSERT_EQ(view1, "k\t2");
+    ASSERT_EQ(view2, "v\t2");
+    decoder.load(qcon);
+    ASSERT_TRUE(decoder >> object >> k1 >> v1);
+    ASSERT_EQ(k1, "k1");
+    ASSERT_EQ(v1, "v1");
+    decoder.zeroCopy = false;
+
     // Error propagation
     decoder.load(R"(^"abc")");
     ASSERT_FALSE(decoder >> v1);
@@ -2342,6 +3701,12 @@ TEST(Decode, streamInteger)
     ASSERT_TRUE(decoder >> v1);
     ASSERT_EQ(v1, 0b101);
 
+    decoder.load(R"(1.5)");
+    ASSERT_FALSE(decoder >> v1);
+
+    decoder.load(R"(123456789e1)");
+    ASSERT_FALSE(decoder >> v1);
+
     // Error propagation
     decoder.load(R"(^1)");
     ASSERT_FALSE(decoder >> v1);
@@ -2604,6 +3969,9 @@ TEST(Decode, streamFloater)
     decoder.load(R"(na)");
     ASSERT_FALSE(decoder >> v1);
 
+    decoder.load(R"(123456789)");
+    ASSERT_FALSE(decoder >> v1);
+
     // Error propagation
     decoder.load(R"(^1.0)");
     ASSERT_FALSE(decoder >> v1);
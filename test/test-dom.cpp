@@ -1,6 +1,9 @@
 #include <qcon-dom.hpp>
 
+#include <bit>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
 
 #include <gtest/gtest.h>
 
@@ -22,11 +25,19 @@ using qcon::Type;
 using qcon::Value;
 using qcon::Object;
 using qcon::Array;
+using qcon::Document;
+using qcon::Tape;
+using qcon::TapeValue;
 using qcon::Date;
 using qcon::Time;
 using qcon::Datetime;
 using qcon::Timepoint;
 using qcon::decode;
+using qcon::decodeFile;
+using qcon::decodeArena;
+using qcon::decodeTape;
+using qcon::decodeParallel;
+using qcon::decodeDocuments;
 using qcon::encode;
 
 using qcon::makeObject;
@@ -578,6 +589,70 @@ TEST(Dom, valueMove)
     ASSERT_EQ(*v1.string(), "abc"sv);
 }
 
+TEST(Dom, inlineStorage)
+{
+    { // String sizes around the inline limit
+        for (u64 size{0u}; size <= 20u; ++size)
+        {
+            const std::string str(size, 'a');
+            Value v{std::string{str}};
+            ASSERT_EQ(*v.string(), str);
+            Value moved{std::move(v)};
+            ASSERT_EQ(*moved.string(), str);
+            v = std::move(moved);
+            ASSERT_EQ(v, str);
+            ASSERT_EQ(*encode(v, qcon::uniline), '"' + str + '"');
+        }
+    }
+    { // Null characters
+        const Value v{"a\0b"sv};
+        ASSERT_EQ(*v.string(), "a\0b"sv);
+    }
+    { // Reassignment between inline and heap strings
+        Value v{"short"};
+        v = "a string too long to be inline"s;
+        ASSERT_EQ(v, "a string too long to be inline");
+        v = "another string too long to be inline"sv;
+        ASSERT_EQ(v, "another string too long to be inline");
+        v = "short"s;
+        ASSERT_EQ(v, "short");
+        v = std::string_view{"a string too long to be inline"};
+        ASSERT_EQ(v, "a string too long to be inline");
+    }
+    { // Assignment from a view of its own string
+        Value v{"a string too long to be inline"};
+        v = v.string()->substr(2u, 6u);
+        ASSERT_EQ(v, "string");
+        v = v.string()->substr(1u);
+        ASSERT_EQ(v, "tring");
+    }
+    { // Swap inline string with heap string
+        Value v1{"short"};
+        Value v2{"a string too long to be inline"};
+        std::swap(v1, v2);
+        ASSERT_EQ(v1, "a string too long to be inline");
+        ASSERT_EQ(v2, "short");
+    }
+    { // Dates and times
+        Value v{Date{2023u, 12u, 31u}};
+        ASSERT_EQ(*v.date(), (Date{2023u, 12u, 31u}));
+        ASSERT_FALSE(v.time());
+        v = Time{23u, 59u, 59u, 999'999'999u};
+        ASSERT_EQ(v.type(), Type::time);
+        ASSERT_EQ(*v.time(), (Time{23u, 59u, 59u, 999'999'999u}));
+        ASSERT_FALSE(v.date());
+        v = Datetime{.date = {2023u, 12u, 31u}, .time = {1u, 2u, 3u}};
+        ASSERT_EQ(v.type(), Type::datetime);
+        ASSERT_EQ(*v.date(), (Date{2023u, 12u, 31u}));
+        ASSERT_EQ(*v.time(), (Time{1u, 2u, 3u}));
+        v = Date{2000u, 1u, 1u};
+        ASSERT_EQ(v.type(), Type::date);
+        ASSERT_EQ(v, (Date{2000u, 1u, 1u}));
+        Value moved{std::move(v)};
+        ASSERT_EQ(moved, (Date{2000u, 1u, 1u}));
+    }
+}
+
 TEST(Dom, valueAssignAndEquality)
 {
     Value v{};
@@ -873,6 +948,139 @@ TEST(Dom, makeObject)
     }
 }
 
+TEST(Dom, object)
+{
+    { // Elements are kept in insertion order
+        Object obj{};
+        ASSERT_TRUE(obj.emplace("b", 2).second);
+        ASSERT_TRUE(obj.emplace("c", 3).second);
+        ASSERT_TRUE(obj.emplace("a", 1).second);
+        ASSERT_FALSE(obj.emplace("b", 4).second);
+        ASSERT_EQ(obj.size(), 3u);
+        std::string keys{};
+        for (const auto & [key, v] : obj)
+        {
+            keys += key;
+        }
+        ASSERT_EQ(keys, "bca");
+        ASSERT_EQ(obj.at("b"), 2);
+    }
+    { // Lookup in small and large objects
+        for (const u64 size : {0u, 1u, 16u, 17u, 100u})
+        {
+            Object obj{};
+            for (u64 i{size}; i-- > 0u;)
+            {
+                obj.emplace(std::to_string(i), i);
+            }
+            ASSERT_EQ(obj.size(), size);
+            for (u64 i{0u}; i < size; ++i)
+            {
+                const std::string key{std::to_string(i)};
+                ASSERT_TRUE(obj.contains(key));
+                ASSERT_EQ(obj.count(key), 1u);
+                ASSERT_EQ(obj.find(key)->first, key);
+                ASSERT_EQ(obj.at(key), i);
+            }
+            ASSERT_FALSE(obj.contains("x"));
+            ASSERT_EQ(obj.find("x"), obj.end());
+            ASSERT_THROW(static_cast<void>(obj.at("x")), std::out_of_range);
+
+            // Erasing shifts the following elements
+            for (u64 i{0u}; i < size; i += 2u)
+            {
+                ASSERT_EQ(obj.erase(std::to_string(i)), 1u);
+            }
+            ASSERT_EQ(obj.size(), size / 2u);
+            for (u64 i{0u}; i < size; ++i)
+            {
+                ASSERT_EQ(obj.contains(std::to_string(i)), i % 2u == 1u);
+            }
+        }
+    }
+    { // Subscript, insert, and erase
+        Object obj{};
+        obj["b"] = 2;
+        ASSERT_EQ(obj["b"], 2);
+        ASSERT_EQ(obj["a"].type(), Type::null);
+        ASSERT_TRUE(obj.insert({"c", 3}).second);
+        ASSERT_FALSE(obj.insert({"c", 4}).second);
+        ASSERT_EQ(obj.size(), 3u);
+        ASSERT_EQ(obj.erase("a"), 1u);
+        ASSERT_EQ(obj.erase("a"), 0u);
+        ASSERT_EQ(obj.erase(obj.find("b"))->first, "c");
+        ASSERT_EQ(obj.size(), 1u);
+        ASSERT_FALSE(obj.contains("b"));
+        ASSERT_TRUE(obj.contains("c"));
+        obj.clear();
+        ASSERT_TRUE(obj.empty());
+    }
+    { // Constructing from elements keeps the first of duplicate keys
+        std::vector<Object::value_type> elements{};
+        elements.emplace_back("b", 1);
+        elements.emplace_back("a", 2);
+        elements.emplace_back("b", 3);
+        const Object obj{std::move(elements)};
+        ASSERT_EQ(obj.size(), 2u);
+        ASSERT_EQ(obj.begin()->first, "b");
+        ASSERT_EQ(obj.at("b"), 1);
+        ASSERT_EQ(obj, makeObject("a", 2, "b", 1));
+        ASSERT_NE(obj, makeObject("a", 2, "b", 3));
+        ASSERT_NE(obj, makeObject("a", 2));
+    }
+    { // Decoding and encoding preserves order
+        const std::optional<Value> decoded{decode(R"({"c": 1, "a": {"z": 2, "y": 3}, "b": 4, "a": 5})")};
+        ASSERT_TRUE(decoded);
+        ASSERT_EQ(*decoded, makeObject("a", makeObject("y", 3, "z", 2), "b", 4, "c", 1));
+        ASSERT_EQ(encode(*decoded, qcon::nospace), R"({"c":1,"a":{"z":2,"y":3},"b":4})");
+    }
+    { // String view lookup
+        Object obj{makeObject("port", 8080, "host", "localhost")};
+        const std::string key{"port"};
+        ASSERT_EQ(obj.find("port"sv)->second, 8080);
+        ASSERT_EQ(obj.find(key)->second, 8080);
+        ASSERT_EQ(obj.find("other"sv), obj.end());
+        ASSERT_TRUE(obj.contains("host"sv));
+        ASSERT_EQ(obj.count("host"sv), 1u);
+        ASSERT_EQ(obj.at("host"sv), "localhost");
+        ASSERT_THROW(static_cast<void>(obj.at("other"sv)), std::out_of_range);
+        ASSERT_EQ(obj["port"sv], 8080);
+        ASSERT_EQ(obj[key], 8080);
+        obj["new"sv] = true;
+        ASSERT_EQ(obj.at("new"), true);
+        ASSERT_EQ(obj.erase("new"sv), 1u);
+        ASSERT_EQ(obj.size(), 2u);
+    }
+}
+
+TEST(Dom, valueLookup)
+{
+    const std::optional<Value> decoded{decode(R"({"server": {"port": 8080, "hosts": ["a", "b"]}, "debug": true})")};
+    ASSERT_TRUE(decoded);
+    const Value & v{*decoded};
+    { // Find
+        ASSERT_TRUE(v.find("debug"sv));
+        ASSERT_EQ(*v.find("debug"sv), true);
+        ASSERT_FALSE(v.find("other"sv));
+        ASSERT_EQ(*v.find("server")->find("port"), 8080);
+        ASSERT_FALSE(v.find("debug")->find("port"));
+        ASSERT_FALSE(Value{}.find("a"));
+    }
+    { // Subscript
+        ASSERT_EQ(v["server"]["port"], 8080);
+        ASSERT_EQ(v["server"sv]["hosts"sv], makeArray("a", "b"));
+        ASSERT_EQ(v["server"]["other"], nullptr);
+        ASSERT_EQ(v["other"]["port"], nullptr);
+        ASSERT_EQ(v["debug"]["port"], nullptr);
+        ASSERT_EQ(v.object()->size(), 2u);
+    }
+    { // Mutable find
+        Value copy{std::move(*decode(R"({"a": 1})"))};
+        *copy.find("a") = 2;
+        ASSERT_EQ(copy["a"], 2);
+    }
+}
+
 TEST(Dom, makeArray)
 {
     { // Generic
@@ -881,7 +1089,7 @@ TEST(Dom, makeArray)
         ASSERT_EQ(arr2.size(), 2u);
         ASSERT_EQ(arr2.capacity(), 2u);
 
-        const std::string * v1{arr2[0].string()};
+        const std::optional<std::string_view> v1{arr2[0].string()};
         ASSERT_TRUE(v1);
         ASSERT_EQ(*v1, "ok");
 
@@ -947,6 +1155,154 @@ TEST(Dom, comments)
     }
 }
 
+TEST(Dom, decodeFile)
+{
+    const std::filesystem::path path{std::filesystem::temp_directory_path() / "qcon-test-dom.qcon"};
+    {
+        std::ofstream file{path};
+        file << R"({"a": [1, 2.5, "three"], "b": null})";
+    }
+    const std::optional<Value> decoded{decodeFile(path)};
+    std::filesystem::remove(path);
+    ASSERT_TRUE(decoded);
+    const Object & obj{*decoded->object()};
+    ASSERT_EQ(obj.size(), 2u);
+    ASSERT_EQ(*obj.at("a").array(), makeArray(1, 2.5, "three"));
+    ASSERT_EQ(obj.at("b").type(), Type::null);
+
+    ASSERT_FALSE(decodeFile(path));
+}
+
+TEST(Dom, decodeParallel)
+{
+    std::string qcon{"[\n"};
+    for (u64 i{0u}; i < 1000u; ++i)
+    {
+        const std::string n{std::to_string(i)};
+        qcon += R"(    {"id": )" + n + R"(, "name": "Item\t)" + n + R"(", "tags": ["a", "]", "#"], "price": )" + n + ".5}, # Comment, with ]\n";
+        qcon += "    [" + n + R"(, "abc" "def", D2000-01-01T00:00:00Z, null, true],)" + "\n";
+    }
+    qcon += "]";
+
+    const std::optional<Value> expected{decode(qcon)};
+    ASSERT_TRUE(expected);
+
+    { // Matches sequential decoding regardless of thread count
+        for (const u64 threads : {0u, 1u, 2u, 3u, 7u, 64u, 10000u})
+        {
+            const std::optional<Value> decoded{decodeParallel(qcon, threads)};
+            ASSERT_TRUE(decoded);
+            ASSERT_EQ(*decoded, *expected);
+        }
+        const std::optional<Value> decoded{decodeParallel(std::string_view{qcon}, 4u)};
+        ASSERT_TRUE(decoded);
+        ASSERT_EQ(*decoded, *expected);
+    }
+    { // Non-array roots and empty arrays
+        ASSERT_EQ(*decodeParallel(R"({"a": [1, 2]})", 4u), makeObject("a", makeArray(1, 2)));
+        ASSERT_EQ(*decodeParallel(R"("abc")", 4u), "abc");
+        ASSERT_EQ(*decodeParallel(R"([])", 4u), Array{});
+        ASSERT_EQ(*decodeParallel(R"([1])", 4u), makeArray(1));
+    }
+    { // Invalid
+        std::string invalid{qcon};
+        invalid.replace(invalid.rfind("true"), 4u, "tru");
+        ASSERT_FALSE(decodeParallel(invalid, 4u));
+        ASSERT_FALSE(decodeParallel(std::string_view{qcon}.substr(0u, qcon.size() - 1u), 4u));
+        const std::string extraneous{qcon + "1"};
+        ASSERT_FALSE(decodeParallel(extraneous, 4u));
+        ASSERT_FALSE(decodeParallel(R"([1 2])", 4u));
+        ASSERT_FALSE(decodeParallel(R"([1, 2}])", 4u));
+    }
+    { // Truncated
+        ASSERT_FALSE(decodeParallel(R"([)", 4u));
+        ASSERT_FALSE(decodeParallel(R"([ # c)", 4u));
+        ASSERT_FALSE(decodeParallel(R"([1,)", 4u));
+    }
+    { // File
+        const std::filesystem::path path{std::filesystem::temp_directory_path() / "qcon-test-dom-parallel.qcon"};
+        {
+            std::ofstream file{path};
+            file << qcon;
+        }
+        const std::optional<Value> decoded{qcon::decodeFileParallel(path, 4u)};
+        std::filesystem::remove(path);
+        ASSERT_TRUE(decoded);
+        ASSERT_EQ(*decoded, *expected);
+    }
+}
+
+TEST(Dom, decodeDocuments)
+{
+    std::string qcon{};
+    std::vector<Value> expected{};
+    for (u64 i{0u}; i < 1000u; ++i)
+    {
+        const std::string n{std::to_string(i)};
+        qcon += R"({"id": )" + n + R"(, "name": "Item\t)" + n + R"(", "tags": ["a", "}", "#"], "price": )" + n + ".5} # Comment, with }\n";
+        qcon += "[" + n + R"(, "abc" "def", D2000-01-01T00:00:00Z, null, true])" + "\n";
+        qcon += R"("ghi" )" + n + "\n";
+        expected.push_back(makeObject("id", i, "name", "Item\t" + n, "tags", makeArray("a", "}", "#"), "price", double(i) + 0.5));
+        expected.push_back(makeArray(i, "abcdef", Datetime{Date{2000u, 1u, 1u}, Time{}, {qcon::utc}}, nullptr, true));
+        expected.push_back("ghi");
+        expected.push_back(i);
+    }
+
+    { // Matches the individual documents regardless of thread count
+        for (const u64 threads : {0u, 1u, 2u, 3u, 7u, 64u, 10000u})
+        {
+            const std::optional<std::vector<Value>> decoded{decodeDocuments(qcon, threads)};
+            ASSERT_TRUE(decoded);
+            ASSERT_EQ(*decoded, expected);
+        }
+        const std::optional<std::vector<Value>> decoded{decodeDocuments(std::string_view{qcon}, 4u)};
+        ASSERT_TRUE(decoded);
+        ASSERT_EQ(*decoded, expected);
+    }
+    { // Few or no documents
+        std::optional<std::vector<Value>> decoded{decodeDocuments(R"({"a": [1, 2]})", 4u)};
+        ASSERT_EQ(decoded->size(), 1u);
+        ASSERT_EQ(decoded->at(0u), makeObject("a", makeArray(1, 2)));
+        decoded = decodeDocuments(R"(1 2)", 4u);
+        ASSERT_EQ(decoded->size(), 2u);
+        ASSERT_EQ(decoded->at(0u), 1);
+        ASSERT_EQ(decoded->at(1u), 2);
+        decoded = decodeDocuments(R"([]{})", 4u);
+        ASSERT_EQ(decoded->size(), 2u);
+        ASSERT_EQ(decoded->at(0u), Array{});
+        ASSERT_EQ(decoded->at(1u), Object{});
+        ASSERT_TRUE(decodeDocuments(R"( # Comment)", 4u)->empty());
+        ASSERT_TRUE(decodeDocuments(R"()", 4u)->empty());
+    }
+    { // Invalid
+        std::string invalid{qcon};
+        invalid.replace(invalid.rfind("true"), 4u, "tru");
+        ASSERT_FALSE(decodeDocuments(invalid, 4u));
+        invalid = qcon;
+        invalid.replace(qcon.find("true"), 4u, "tru");
+        ASSERT_FALSE(decodeDocuments(invalid, 4u));
+        ASSERT_FALSE(decodeDocuments(std::string_view{qcon}.substr(0u, qcon.rfind("true")), 4u));
+        ASSERT_FALSE(decodeDocuments(R"([1, 2]])", 4u));
+        ASSERT_FALSE(decodeDocuments(R"({"a": 1)", 4u));
+    }
+    { // File
+        const std::filesystem::path path{std::filesystem::temp_directory_path() / "qcon-test-dom-documents.qcon"};
+        {
+            std::ofstream file{path};
+            file << qcon;
+        }
+        const std::optional<std::vector<Value>> decoded{qcon::decodeFileDocuments(path, 4u)};
+        std::filesystem::remove(path);
+        ASSERT_TRUE(decoded);
+        ASSERT_EQ(*decoded, expected);
+    }
+    { // Missing file
+        const std::filesystem::path path{std::filesystem::temp_directory_path() / "qcon-test-dom-missing.qcon"};
+        ASSERT_FALSE(qcon::decodeFileDocuments(path));
+        ASSERT_FALSE(qcon::decodeFileDocuments(path, 4u));
+    }
+}
+
 TEST(Dom, numberEquality)
 {
     { // Signed integer
@@ -1014,6 +1370,233 @@ TEST(Dom, numberEquality)
     }
 }
 
+static bool tapeMatches(const TapeValue tape, const Value & value)
+{
+    if (tape.type() != value.type())
+    {
+        return false;
+    }
+
+    switch (value.type())
+    {
+        case Type::object:
+        {
+            if (tape.size() != value.object()->size())
+            {
+                return false;
+            }
+            for (const auto & [key, v] : *value.object())
+            {
+                const std::optional<TapeValue> member{tape.find(key)};
+                if (!member || !tapeMatches(*member, v))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case Type::array:
+        {
+            if (tape.size() != value.array()->size())
+            {
+                return false;
+            }
+            auto it{tape.begin()};
+            for (const Value & v : *value.array())
+            {
+                if (!tapeMatches(*it, v))
+                {
+                    return false;
+                }
+                ++it;
+            }
+            return it == tape.end();
+        }
+        case Type::string: return value == *tape.string();
+        case Type::integer: return value == *tape.integer() && tape.positive() == value.positive();
+        case Type::floater: return std::bit_cast<u64>(*tape.floater()) == std::bit_cast<u64>(*value.floater());
+        case Type::boolean: return value == *tape.boolean();
+        case Type::date: return value == *tape.date();
+        case Type::time: return value == *tape.time();
+        case Type::datetime: return value == *tape.datetime();
+        case Type::null: return tape.null();
+    }
+
+    return false;
+}
+
+TEST(Dom, tape)
+{
+    { // Scalars
+        ASSERT_EQ(decodeTape(R"("abc")"sv)->root().string(), "abc"sv);
+        ASSERT_EQ(decodeTape(R"(-123)"sv)->root().integer(), -123);
+        ASSERT_FALSE(decodeTape(R"(-123)"sv)->root().positive());
+        ASSERT_EQ(decodeTape(R"(18446744073709551615)"sv)->root().integer(), -1);
+        ASSERT_TRUE(decodeTape(R"(18446744073709551615)"sv)->root().positive());
+        ASSERT_EQ(decodeTape(R"(1.5)"sv)->root().floater(), 1.5);
+        ASSERT_EQ(decodeTape(R"(true)"sv)->root().boolean(), true);
+        ASSERT_EQ(decodeTape(R"(D2023-12-31)"sv)->root().date(), (Date{2023u, 12u, 31u}));
+        ASSERT_EQ(decodeTape(R"(T23:59:59.999999999)"sv)->root().time(), (Time{23u, 59u, 59u, 999'999'999u}));
+        const std::optional<Tape> tape{decodeTape(R"(null)"sv)};
+        ASSERT_TRUE(tape->root().null());
+        ASSERT_EQ(tape->root().size(), 0u);
+        ASSERT_EQ(tape->root().begin(), tape->root().end());
+    }
+    { // Datetime
+        const std::optional<Tape> tape{decodeTape(R"(D2003-06-28T13:59:11.067-23:59)"sv)};
+        ASSERT_TRUE(tape);
+        const std::optional<Datetime> datetime{tape->root().datetime()};
+        ASSERT_TRUE(datetime);
+        ASSERT_EQ(datetime->date, (Date{2003u, 6u, 28u}));
+        ASSERT_EQ(datetime->time, (Time{13u, 59u, 11u, 67'000'000u}));
+        ASSERT_EQ(datetime->zone.format, qcon::utcOffset);
+        ASSERT_EQ(datetime->zone.offset, -1439);
+        ASSERT_EQ(tape->root().date(), datetime->date);
+        ASSERT_EQ(tape->root().time(), datetime->time);
+    }
+    { // Wrong type
+        const std::optional<Tape> tape{decodeTape(R"("abc")"sv)};
+        ASSERT_TRUE(tape);
+        ASSERT_FALSE(tape->root().integer());
+        ASSERT_FALSE(tape->root().floater());
+        ASSERT_FALSE(tape->root().boolean());
+        ASSERT_FALSE(tape->root().date());
+        ASSERT_FALSE(tape->root().time());
+        ASSERT_FALSE(tape->root().datetime());
+        ASSERT_FALSE(tape->root().null());
+        ASSERT_FALSE(tape->root().positive());
+        ASSERT_FALSE(tape->root().find("abc"sv));
+        ASSERT_FALSE(tape->root().element(0u));
+    }
+    { // Navigation
+        const std::optional<Tape> tape{decodeTape(R"({"a": [1, {"b": [2, 3]}, [], "c"], "d": {}, "e": D2000-01-01T00:00:00Z, "f": "g"})"sv)};
+        ASSERT_TRUE(tape);
+        const TapeValue root{tape->root()};
+        ASSERT_EQ(root.type(), Type::object);
+        ASSERT_EQ(root.size(), 4u);
+        ASSERT_EQ(root.find("f"sv)->string(), "g"sv);
+        ASSERT_EQ(root.find("d"sv)->type(), Type::object);
+        ASSERT_EQ(root.find("d"sv)->size(), 0u);
+        ASSERT_EQ(root.find("e"sv)->type(), Type::datetime);
+        ASSERT_FALSE(root.find("b"sv));
+        const TapeValue a{*root.find("a"sv)};
+        ASSERT_EQ(a.size(), 4u);
+        ASSERT_EQ(a.element(0u)->integer(), 1);
+        ASSERT_EQ(a.element(1u)->find("b"sv)->element(1u)->integer(), 3);
+        ASSERT_EQ(a.element(2u)->size(), 0u);
+        ASSERT_EQ(a.element(3u)->string(), "c"sv);
+        ASSERT_FALSE(a.element(4u));
+
+        std::string keys{};
+        for (auto it{root.begin()}; it != root.end(); ++it)
+        {
+            keys += it.key();
+        }
+        ASSERT_EQ(keys, "adef"s);
+    }
+    { // Matches the value tree
+        const std::string qcon(R"({
+            "Dishes": [
+                {"Gluten Free": false, "Ingredients": ["\"Salt\"", "Barnacles"], "Name": "Basket o' Barnacles", "Price": 5.45},
+                {"Gluten Free": true, "Ingredients": ["Tuna"], "Name": "Two Tuna", "Price": -inf},
+                {"Gluten Free": false, "Ingredients": ["\"Salt\"", "Octopus", "Crab"], "Name": "18 Leg Bouquet", "Price": nan}
+            ],
+            "Founded": D1964-03-17,
+            "Ha\x03r Name": "M\0\0n",
+            "Last Updated": D2003-06-28T13:59:11.067Z,
+            "Magic Numbers": [777, -777, 0x777, []],
+            "Name": "Salt's" " Crust",
+            "Opens": T08:30:00,
+            "Profit Margin": null
+        })"s);
+        const std::optional<Tape> tape{decodeTape(qcon)};
+        const std::optional<Value> value{decode(qcon)};
+        ASSERT_TRUE(tape);
+        ASSERT_TRUE(value);
+        ASSERT_TRUE(tapeMatches(tape->root(), *value));
+    }
+    { // Invalid
+        ASSERT_FALSE(decodeTape(R"({"a": [1, 2})"sv));
+        ASSERT_FALSE(decodeTape(R"([1, 2] 3)"sv));
+        ASSERT_FALSE(decodeTape(R"()"sv));
+    }
+}
+
+TEST(Dom, document)
+{
+    const std::string qcon{R"({
+        "a": [1, -2, 3.5, true, null, "short", "a string too long for the small buffer"],
+        "b": {"c": D2023-12-31, "d": T23:59:59, "e": D2003-06-28T13:59:11.067Z},
+        "f": [[], {}]
+    })"s};
+    { // Matches regular decode
+        const std::optional<Document> document{decodeArena(qcon)};
+        ASSERT_TRUE(document);
+        ASSERT_EQ(document->root(), *decode(qcon));
+        ASSERT_EQ(*encode(document->root()), *encode(*decode(qcon)));
+    }
+    { // Scalar roots
+        ASSERT_EQ(decodeArena(R"("abc")"sv)->root(), "abc");
+        ASSERT_EQ(decodeArena(R"(-123)"sv)->root(), -123);
+        ASSERT_EQ(decodeArena(R"(D2023-12-31)"sv)->root(), (Date{2023u, 12u, 31u}));
+        ASSERT_EQ(decodeArena(R"(null)"sv)->root(), nullptr);
+    }
+    { // Modification
+        std::optional<Document> document{decodeArena(qcon)};
+        ASSERT_TRUE(document);
+        Object & root{*document->root().object()};
+        root["a"].array()->push_back("another string too long for the small buffer");
+        root["a"].array()->emplace_back(makeArray(1, 2, 3));
+        root["b"] = 7;
+        root["f"] = "abc";
+        root.erase("f");
+        root["g"] = makeObject("h", Date{2003u, 6u, 28u});
+        ASSERT_EQ(root["a"].array()->size(), 9u);
+        ASSERT_EQ(root["a"].array()->at(7u), "another string too long for the small buffer");
+        ASSERT_EQ(root["a"].array()->at(8u), makeArray(1, 2, 3));
+        ASSERT_EQ(root["b"], 7);
+        ASSERT_FALSE(root.contains("f"));
+        ASSERT_EQ(root["g"], makeObject("h", Date{2003u, 6u, 28u}));
+    }
+    { // Move
+        std::optional<Document> document{decodeArena(qcon)};
+        ASSERT_TRUE(document);
+        Document moved{std::move(*document)};
+        document.reset();
+        ASSERT_EQ(moved.root(), *decode(qcon));
+        moved = std::move(*decodeArena(R"([1, "a string too long for the small buffer"])"sv));
+        ASSERT_EQ(moved.root(), makeArray(1, "a string too long for the small buffer"));
+    }
+    { // Large
+        std::string large{"["};
+        for (u64 i{0u}; i < 1000u; ++i)
+        {
+            large += R"({"key": "value", "list": [1, 2, 3]}, )";
+        }
+        large += "]";
+        const std::optional<Document> document{decodeArena(large)};
+        ASSERT_TRUE(document);
+        ASSERT_EQ(document->root().array()->size(), 1000u);
+        ASSERT_EQ(document->root(), *decode(large));
+    }
+    { // File
+        const std::filesystem::path path{std::filesystem::temp_directory_path() / "qcon-test-document.qcon"};
+        {
+            std::ofstream file{path};
+            file << qcon;
+        }
+        const std::optional<Document> document{qcon::decodeArenaFile(path)};
+        std::filesystem::remove(path);
+        ASSERT_TRUE(document);
+        ASSERT_EQ(document->root(), *decode(qcon));
+    }
+    { // Invalid
+        ASSERT_FALSE(decodeArena(R"({"a": [1, 2})"sv));
+        ASSERT_FALSE(decodeArena(R"([1, 2] 3)"sv));
+        ASSERT_FALSE(decodeArena(R"()"sv));
+    }
+}
+
 TEST(Dom, general)
 {
     const std::string qcon(R"({
@@ -36,6 +36,19 @@ Encoder & operator<<(Encoder & encoder, const CustomVal & v)
     return encoder << uniline << array << v.x << v.y << end;
 }
 
+struct BoundVal { std::string name; std::vector<CustomVal> vals; };
+struct BoundOuter { BoundVal inner; std::chrono::year_month_day date; std::chrono::minutes time; bool flag; };
+
+template <> struct qcon::Binding<BoundVal>
+{
+    static constexpr auto fields{qcon::fields("Name", &BoundVal::name, "Vals", &BoundVal::vals)};
+};
+
+template <> struct qcon::Binding<BoundOuter>
+{
+    static constexpr auto fields{qcon::fields("Inner", &BoundOuter::inner, "Date", &BoundOuter::date, "Time", &BoundOuter::time, "Flag", &BoundOuter::flag)};
+};
+
 template <typename T>
 std::ostream & operator<<(std::ostream & os, const std::optional<T> & v)
 {
@@ -951,6 +964,18 @@ TEST(Encode, custom)
     ASSERT_EQ(encoder.finish(), "[ 1, 2 ]");
 }
 
+TEST(Encode, binding)
+{
+    const BoundOuter v{
+        .inner = {.name = "abc", .vals = {{1, 2}, {3, 4}}},
+        .date = std::chrono::year_month_day{std::chrono::year{2000}, std::chrono::month{1}, std::chrono::day{2}},
+        .time = std::chrono::hours{8} + std::chrono::minutes{30},
+        .flag = true};
+    Encoder encoder{uniline};
+    encoder << v;
+    ASSERT_EQ(encoder.finish(), R"({ "Inner": { "Name": "abc", "Vals": [ [ 1, 2 ], [ 3, 4 ] ] }, "Date": D2000-01-02, "Time": T08:30:00, "Flag": true })");
+}
+
 TEST(Encode, reset)
 {
     {